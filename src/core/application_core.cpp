@@ -99,6 +99,12 @@ void ApplicationCore::MainLoop()
 		const float postRenderTime = Util::GetSecondsSinceEpoch();
 		elapsedRenderTime = postRenderTime - preRenderTime;
 	}
+
+	// Log how often text layouts were reused over the session
+	const Renderer::TextSizeCacheStats& textSizeStats = Renderer::GetInstance().GetTextSizeCacheStats();
+	LogSystem::GetInstance().OutputLog("Text size cache: " + std::to_string(textSizeStats.hits) + " hits, " + std::to_string(textSizeStats.misses) +
+		" misses (" + std::to_string((int)(textSizeStats.GetHitRate() * 100.0f)) + "% hit rate), " + std::to_string(textSizeStats.totalEntries) +
+		" entries", Severity::INFO);
 }
 
 void ApplicationCore::Update(const float& deltaTime)
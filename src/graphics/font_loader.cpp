@@ -51,6 +51,7 @@ Font::Font(FT_Library& lib, const std::string_view& fileName, uint32_t resolutio
 		glyphMetrics.textureOffsetX = totalBitmapWidth;
 
 		this->glyphs[glyph] = glyphMetrics;
+		this->asciiGlyphs[(size_t)glyph] = glyphMetrics;
 
 		// Update the total bitmap width and height counters
 		constexpr uint32_t glyphBitmapOffset = 10;
@@ -94,6 +95,14 @@ const GlyphMap& Font::GetGlyphs() const
 	return this->glyphs;
 }
 
+const GlyphData& Font::GetGlyph(char character) const
+{
+	if (character >= 0 && (size_t)character < this->asciiGlyphs.size())
+		return this->asciiGlyphs[(size_t)character];
+
+	return this->glyphs.at(character);
+}
+
 const TextureBuffer2DPtr Font::GetBitmap() const
 {
 	return this->bitmapTexture;
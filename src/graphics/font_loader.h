@@ -4,6 +4,7 @@
 #include <graphics/buffer_objects.h>
 
 #include <glm/glm.hpp>
+#include <array>
 #include <unordered_map>
 #include <string>
 
@@ -25,6 +26,7 @@ private:
 
 	TextureBuffer2DPtr bitmapTexture;
 	GlyphMap glyphs;
+	std::array<GlyphData, 128> asciiGlyphs; // A flat copy of the ASCII glyphs, so measuring text doesn't have to hash every character
 	uint32_t resolution, styleIndex;
 public:
 	Font(FT_Library& lib, const std::string_view& fileName, uint32_t resolution, uint32_t styleIndex);
@@ -36,6 +38,9 @@ public:
 	// Returns the data of each glyph loaded from the font file.
 	const GlyphMap& GetGlyphs() const;
 
+	// Returns the data of the glyph matching the character given, ASCII characters are looked up in a flat table rather than the map.
+	const GlyphData& GetGlyph(char character) const;
+
 	// Returns the generated bitmap texture loaded from the font file.
 	const TextureBuffer2DPtr GetBitmap() const;
 
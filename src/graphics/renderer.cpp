@@ -6,6 +6,12 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <glad/glad.h>
 
+namespace
+{
+	// The most text sizes kept in the text size cache, the least recently used size is dropped once it's full
+	constexpr size_t maxCachedTextSizes = 4096;
+}
+
 Renderer::Renderer() :
 	gamma(2.2f)
 {}
@@ -79,7 +85,7 @@ Renderer::BatchedData Renderer::GenerateBatchedTextData(const FontPtr font, cons
 	for (const char& character : text)
 	{
 		// Generate the vertex coords
-		const GlyphData& glyph = font->GetGlyphs().at(character);
+		const GlyphData& glyph = font->GetGlyph(character);
 
 		glm::vec2 topLeftVertex;
 		firstCharacter ?
@@ -267,7 +273,7 @@ void Renderer::Clear() const
 	GLValidate(glClear(GL_COLOR_BUFFER_BIT));
 }
 
-glm::vec2 Renderer::GetTextSize(const FontPtr font, uint32_t fontSize, const std::string_view& text) const
+glm::vec2 Renderer::MeasureText(const FontPtr font, uint32_t fontSize, const std::string_view& text) const
 {
 	glm::vec2 totalSize;
 	float minY = 0.0f, maxY = 0.0f;
@@ -275,7 +281,7 @@ glm::vec2 Renderer::GetTextSize(const FontPtr font, uint32_t fontSize, const std
 
 	for (uint32_t i = 0; i < text.size(); i++)
 	{
-		const GlyphData& glyphMetrics = font->GetGlyphs().at(text[i]);
+		const GlyphData& glyphMetrics = font->GetGlyph(text[i]);
 
 		// WIDTH
 		if (firstCharacter)
@@ -303,6 +309,58 @@ glm::vec2 Renderer::GetTextSize(const FontPtr font, uint32_t fontSize, const std
 	return totalSize;
 }
 
+glm::vec2 Renderer::GetTextSize(const FontPtr font, uint32_t fontSize, const std::string_view& text) const
+{
+	// Combine the hashes of the font, font size and text into the cache key
+	size_t key = std::hash<std::string_view>()(text);
+	key ^= std::hash<const Font*>()(font.get()) + 0x9e3779b97f4a7c15 + (key << 6) + (key >> 2);
+	key ^= std::hash<uint32_t>()(fontSize) + 0x9e3779b97f4a7c15 + (key << 6) + (key >> 2);
+
+	auto lookup = this->textSizeLookup.find(key);
+	if (lookup != this->textSizeLookup.end())
+	{
+		const TextSizeEntry& entry = *lookup->second;
+		if (entry.font == font && entry.fontSize == fontSize && entry.text == text)
+		{
+			// Move the entry to the front, as it's now the most recently used
+			this->textSizeCache.splice(this->textSizeCache.begin(), this->textSizeCache, lookup->second);
+			this->textSizeCacheStats.hits++;
+			return entry.size;
+		}
+
+		// A different text shares the key, so it's replaced by this one
+		this->textSizeCache.erase(lookup->second);
+		this->textSizeLookup.erase(lookup);
+	}
+
+	this->textSizeCacheStats.misses++;
+	const glm::vec2 size = this->MeasureText(font, fontSize, text);
+
+	// Drop the least recently used size to make room for the new one
+	if (this->textSizeCache.size() >= maxCachedTextSizes)
+	{
+		this->textSizeLookup.erase(this->textSizeCache.back().key);
+		this->textSizeCache.pop_back();
+	}
+
+	this->textSizeCache.push_front({ font, fontSize, std::string(text), key, size });
+	this->textSizeLookup[key] = this->textSizeCache.begin();
+	this->textSizeCacheStats.totalEntries = this->textSizeCache.size();
+
+	return size;
+}
+
+const Renderer::TextSizeCacheStats& Renderer::GetTextSizeCacheStats() const
+{
+	return this->textSizeCacheStats;
+}
+
+float Renderer::TextSizeCacheStats::GetHitRate() const
+{
+	const uint64_t totalLookups = this->hits + this->misses;
+	return (totalLookups > 0) ? (float)this->hits / (float)totalLookups : 0.0f;
+}
+
 const OrthogonalCamera& Renderer::GetViewport() const
 {
 	return this->viewport;
@@ -9,11 +9,33 @@
 #include <graphics/vertex_array.h>
 
 #include <glm/glm.hpp>
+#include <list>
+#include <unordered_map>
 
 class Renderer
 {
+public:
+	// How often text sizes were answered by the text size cache rather than measured
+	struct TextSizeCacheStats
+	{
+		uint64_t hits = 0, misses = 0;
+		size_t totalEntries = 0;
+
+		// Returns the share of text size lookups answered by the cache.
+		float GetHitRate() const;
+	};
 private:
 	using BatchedData = std::pair<std::vector<float>, std::vector<uint32_t>>;
+
+	// A measured text size, along with the font, font size and text it was measured for
+	struct TextSizeEntry
+	{
+		FontPtr font; // Holding onto the font stops its address being reused by another font while the entry is cached
+		uint32_t fontSize = 0;
+		std::string text;
+		size_t key = 0;
+		glm::vec2 size;
+	};
 private:
 	WindowFramePtr appWindow;
 	OrthogonalCamera viewport;
@@ -24,6 +46,12 @@ private:
 
 	glm::vec4 clearColor;
 	float gamma;
+
+	// The text sizes measured most recently, ordered from the most recently used and looked up by the hash of their font, size and text.
+	// Text is measured from the main thread only, so the cache isn't locked.
+	mutable std::list<TextSizeEntry> textSizeCache;
+	mutable std::unordered_map<size_t, std::list<TextSizeEntry>::iterator> textSizeLookup;
+	mutable TextSizeCacheStats textSizeCacheStats;
 private:
 	Renderer();
 
@@ -34,6 +62,9 @@ private:
 	// The vertex and index data inside the vectors are the result of all the glyphs in the text given having their
 	// vertex and index data all batched into their respective vector containers.
 	BatchedData GenerateBatchedTextData(const FontPtr font, const std::string_view& text) const;
+
+	// Returns the size of the given text string measured from the font's glyph metrics.
+	glm::vec2 MeasureText(const FontPtr font, uint32_t fontSize, const std::string_view& text) const;
 public:
 	Renderer(const Renderer& other) = delete;
 	Renderer(Renderer&& other) noexcept = delete;
@@ -71,8 +102,12 @@ public:
 	void Clear() const;
 
 	// Returns the expected size of the given text string when rendered.
+	// The sizes are kept in a bounded LRU cache, so measuring the same text again only costs a hash lookup.
 	glm::vec2 GetTextSize(const FontPtr font, uint32_t fontSize, const std::string_view& text) const;
 
+	// Returns how often text sizes have been answered by the text size cache.
+	const TextSizeCacheStats& GetTextSizeCacheStats() const;
+
 	// Returns the renderer viewport camera.
 	const OrthogonalCamera& GetViewport() const;
 	
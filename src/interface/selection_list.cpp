@@ -1,13 +1,23 @@
 #include <interface/selection_list.h>
 #include <graphics/renderer.h>
 
+#include <algorithm>
+
+namespace
+{
+    // The most categories the list is sorted by at once, ties in the last clicked category are broken by the ones clicked before it
+    constexpr size_t maxSortColumns = 3;
+}
+
 SelectionList::SelectionList() :
-    fontSize(0), listOffset(0), opacity(0.0f), maxListSelectionsVisible(0), buttonHeight(0.0f), currentSelected(nullptr)
+    fontSize(0), listOffset(0), opacity(0.0f), maxListSelectionsVisible(0), buttonHeight(0.0f), currentSelected(-1), totalSourceRows(0),
+    sortingEnabled(false), totalSorted(0), orderOutdated(true), rowsOutdated(true)
 {}
 
 SelectionList::SelectionList(const glm::vec2& pos, const glm::vec2& size, float buttonHeight, float opacity, float fontSize) :
-    position(pos), size(size), buttonHeight(buttonHeight), opacity(opacity), listOffset(0), currentSelected(nullptr),
-    fontSize(fontSize > 0.0f ? fontSize : (buttonHeight / 2.75f))
+    position(pos), size(size), buttonHeight(buttonHeight), opacity(opacity), listOffset(0), currentSelected(-1),
+    fontSize(fontSize > 0.0f ? fontSize : (buttonHeight / 2.75f)), totalSourceRows(0), sortingEnabled(false), totalSorted(0), orderOutdated(true),
+    rowsOutdated(true)
 {
     // Load the font to be used
     this->font = FontLoader::GetInstance().GetFont("Bahnschrift Bold");
@@ -29,84 +39,331 @@ void SelectionList::SetOpacity(float opacity)
     this->previousPageButton.SetOpacity(opacity);
     this->nextPageButton.SetOpacity(opacity);
 
-    for (Element& element : this->listElements)
-        element.button.SetOpacity(opacity);
+    for (ButtonBase& button : this->categoryButtons)
+        button.SetOpacity(opacity);
+
+    for (VisibleRow& row : this->visibleRows)
+        row.button.SetOpacity(opacity);
+}
+
+void SelectionList::AddCategory(const std::string_view& name, SortType sortType)
+{
+    this->listCategories.push_back({ name.data(), Renderer::GetInstance().GetTextSize(this->font, (uint32_t)this->fontSize, name), sortType });
+
+    // The header cells get narrower with every category added, so the buttons covering them are laid out again
+    const float categoryWidth = this->size.x / (float)this->listCategories.size();
+    this->categoryButtons.clear();
+
+    for (size_t index = 0; index < this->listCategories.size(); index++)
+    {
+        this->categoryButtons.emplace_back(glm::vec2(this->position.x - (this->size.x / 2) + ((index + 0.5f) * categoryWidth),
+            this->position.y - ((this->size.y - this->buttonHeight) / 2)), glm::vec2(categoryWidth, this->buttonHeight),
+            glm::vec2(categoryWidth, this->buttonHeight), glm::vec3(60), glm::vec3(60), glm::vec3(60), this->opacity, 0.0f);
+    }
 }
 
-void SelectionList::AddCategory(const std::string_view& name)
+void SelectionList::SetSortingEnabled(bool enabled)
 {
-    this->listCategories.push_back({ name.data(), Renderer::GetInstance().GetTextSize(this->font, (uint32_t)this->fontSize, name) });
+    this->sortingEnabled = enabled;
 }
 
-void SelectionList::AddElement(const std::vector<std::string>& categoryValues, int value, const glm::vec3& baseColor, const glm::vec3& highlightColor, 
+void SelectionList::FetchRow(size_t index, Element& element) const
+{
+    if (this->rowFetcher)
+        this->rowFetcher(index, element);
+    else
+        element = this->listElements[index];
+}
+
+void SelectionList::GatherSortValues() const
+{
+    const size_t totalRows = this->GetTotalRows();
+    this->sortValues.assign(this->sortColumns.size(), SortColumnValues());
+
+    Element element;
+    for (size_t columnIndex = 0; columnIndex < this->sortColumns.size(); columnIndex++)
+    {
+        const int category = this->sortColumns[columnIndex].category;
+        SortColumnValues& values = this->sortValues[columnIndex];
+
+        if (this->listCategories[category].sortType == SortType::KEY)
+        {
+            values.keys.resize(totalRows);
+            for (size_t index = 0; index < totalRows; index++)
+            {
+                if (this->sortKeyFetcher)
+                {
+                    values.keys[index] = this->sortKeyFetcher(index, category);
+                }
+                else if (!this->rowFetcher)
+                {
+                    const std::vector<int64_t>& sortKeys = this->listElements[index].sortKeys;
+                    values.keys[index] = (category < (int)sortKeys.size()) ? sortKeys[category] : 0;
+                }
+                else
+                {
+                    this->FetchRow(index, element);
+                    values.keys[index] = (category < (int)element.sortKeys.size()) ? element.sortKeys[category] : 0;
+                }
+            }
+        }
+        else
+        {
+            values.texts.resize(totalRows);
+            for (size_t index = 0; index < totalRows; index++)
+            {
+                if (this->sortTextFetcher)
+                {
+                    values.texts[index] = this->sortTextFetcher(index, category);
+                }
+                else if (!this->rowFetcher)
+                {
+                    const std::vector<std::string>& categoryValues = this->listElements[index].categoryValues;
+                    if (category < (int)categoryValues.size())
+                        values.texts[index] = categoryValues[category];
+                }
+                else
+                {
+                    this->FetchRow(index, element);
+                    if (category < (int)element.categoryValues.size())
+                        values.texts[index] = std::move(element.categoryValues[category]);
+                }
+            }
+        }
+    }
+}
+
+bool SelectionList::IsOrderedBefore(uint32_t firstIndex, uint32_t secondIndex) const
+{
+    for (size_t columnIndex = 0; columnIndex < this->sortColumns.size(); columnIndex++)
+    {
+        const SortColumnValues& values = this->sortValues[columnIndex];
+
+        int comparison = 0;
+        if (!values.keys.empty())
+        {
+            const int64_t firstKey = values.keys[firstIndex], secondKey = values.keys[secondIndex];
+            comparison = (firstKey < secondKey) ? -1 : (firstKey > secondKey) ? 1 : 0;
+        }
+        else if (!values.texts.empty())
+        {
+            comparison = values.texts[firstIndex].compare(values.texts[secondIndex]);
+        }
+
+        if (comparison != 0)
+            return this->sortColumns[columnIndex].descending ? (comparison > 0) : (comparison < 0);
+    }
+
+    // Rows which are equal in every sorted category keep the order they were added in, so the sort is stable
+    return firstIndex < secondIndex;
+}
+
+void SelectionList::SortDisplayOrder(size_t end) const
+{
+    if (this->sortColumns.empty())
+        return;
+
+    // The values being compared are gathered up front, so comparisons don't have to fetch rows
+    if (this->orderOutdated)
+    {
+        this->displayOrder.resize(this->GetTotalRows());
+        for (uint32_t index = 0; index < (uint32_t)this->displayOrder.size(); index++)
+            this->displayOrder[index] = index;
+
+        this->GatherSortValues();
+        this->totalSorted = 0;
+        this->orderOutdated = false;
+    }
+
+    end = std::min(end, this->displayOrder.size());
+    if (end <= this->totalSorted)
+        return;
+
+    // Move the rows belonging before the end position in front of it in linear time, then only sort those rows
+    const auto comparator = [this](uint32_t first, uint32_t second) { return this->IsOrderedBefore(first, second); };
+    const auto sortedEnd = this->displayOrder.begin() + this->totalSorted;
+
+    if (end < this->displayOrder.size())
+        std::nth_element(sortedEnd, this->displayOrder.begin() + end, this->displayOrder.end(), comparator);
+
+    std::sort(sortedEnd, this->displayOrder.begin() + end, comparator);
+    this->totalSorted = end;
+}
+
+void SelectionList::BindVisibleRows() const
+{
+    if (!this->rowsOutdated)
+        return;
+
+    const int pageEnd = std::min(this->listOffset + this->maxListSelectionsVisible, (int)this->GetTotalRows());
+    this->SortDisplayOrder((size_t)std::max(pageEnd, 0));
+
+    // The row widgets are recycled, so they're only ever as many as fit on a page
+    this->visibleRows.resize((size_t)std::max(pageEnd - this->listOffset, 0));
+
+    for (int row = 0; row < (int)this->visibleRows.size(); row++)
+    {
+        const int displayIndex = this->listOffset + row;
+        VisibleRow& visibleRow = this->visibleRows[row];
+
+        this->FetchRow(this->sortColumns.empty() ? (size_t)displayIndex : this->displayOrder[displayIndex], visibleRow.element);
+
+        // Only the text of the rows being shown is measured
+        visibleRow.textSizes.resize(visibleRow.element.categoryValues.size());
+        for (size_t category = 0; category < visibleRow.element.categoryValues.size(); category++)
+        {
+            visibleRow.textSizes[category] = Renderer::GetInstance().GetTextSize(this->font, (uint32_t)this->fontSize,
+                visibleRow.element.categoryValues[category]);
+        }
+
+        visibleRow.button = ButtonBase(this->GetRowPosition(row), { this->size.x, this->buttonHeight }, { this->size.x, this->buttonHeight },
+            visibleRow.element.baseColor, visibleRow.element.highlightColor, visibleRow.element.edgeColor, this->opacity, 2.5f);
+    }
+
+    this->rowsOutdated = false;
+}
+
+void SelectionList::InvalidateRows()
+{
+    this->orderOutdated = true;
+    this->rowsOutdated = true;
+}
+
+glm::vec2 SelectionList::GetRowPosition(int row) const
+{
+    return { this->position.x, this->position.y - ((this->size.y + this->buttonHeight) / 2) + (2 * this->buttonHeight) + (row * this->buttonHeight) };
+}
+
+void SelectionList::AddElement(const std::vector<std::string>& categoryValues, int value, const glm::vec3& baseColor, const glm::vec3& highlightColor,
     const glm::vec3& edgeColor)
 {
-    // Calculate the sizes of the category text values
-    std::vector<Category> categoryVals;
-    for (const std::string& categoryValue : categoryValues)
-        categoryVals.push_back({ categoryValue, Renderer::GetInstance().GetTextSize(this->font, (uint32_t)this->fontSize, categoryValue) });
+    this->AddElement(categoryValues, {}, value, baseColor, highlightColor, edgeColor);
+}
+
+void SelectionList::AddElement(const std::vector<std::string>& categoryValues, const std::vector<int64_t>& sortKeys, int value,
+    const glm::vec3& baseColor, const glm::vec3& highlightColor, const glm::vec3& edgeColor)
+{
+    // Elements and a data source can't be mixed, so adding an element drops the data source
+    if (this->rowFetcher)
+        this->Clear();
 
-    // Push the element into the list
-    this->listElements.push_back({ categoryVals,
-        ButtonBase({ this->position.x, this->position.y - ((this->size.y + this->buttonHeight) / 2) + (2 * this->buttonHeight) +
-            (((this->listElements.size()) % (this->maxListSelectionsVisible)) * this->buttonHeight) }, { this->size.x, this->buttonHeight }, 
-            { this->size.x, this->buttonHeight }, baseColor, highlightColor, edgeColor, 255.0f, 2.5f), value });
+    // The element's text is only measured and given a button once it's shown
+    this->listElements.push_back({ categoryValues, sortKeys, value, baseColor, highlightColor, edgeColor });
+    this->InvalidateRows();
+}
+
+void SelectionList::SetDataSource(size_t totalRows, const RowFetcher& rowFetcher, const SortKeyFetcher& sortKeyFetcher, 
+    const SortTextFetcher& sortTextFetcher)
+{
+    this->Clear();
+
+    this->totalSourceRows = totalRows;
+    this->rowFetcher = rowFetcher;
+    this->sortKeyFetcher = sortKeyFetcher;
+    this->sortTextFetcher = sortTextFetcher;
 }
 
 void SelectionList::Clear()
 {
     this->listElements.clear();
+    this->rowFetcher = nullptr;
+    this->sortKeyFetcher = nullptr;
+    this->sortTextFetcher = nullptr;
+    this->totalSourceRows = 0;
+
+    this->displayOrder.clear();
+    this->sortValues.clear();
     this->listOffset = 0;
+    this->InvalidateRows();
 }
 
 void SelectionList::Reset()
 {
-    this->currentSelected = nullptr;
+    this->currentSelected = -1;
 }
 
 void SelectionList::Update(const float& deltaTime)
 {
     if (this->opacity > 0)
     {
-        for (int index = this->listOffset; index < std::min(this->listOffset + this->maxListSelectionsVisible, (int)this->listElements.size()); index++)
+        // Sort the list by a category once its header is clicked, clicking the category the list is already sorted by reverses the order
+        if (this->sortingEnabled)
+        {
+            for (int index = 0; index < (int)this->categoryButtons.size(); index++)
+            {
+                this->categoryButtons[index].Update(deltaTime, 8.0f);
+                if (!this->categoryButtons[index].WasClicked())
+                    continue;
+
+                if (!this->sortColumns.empty() && this->sortColumns.front().category == index)
+                {
+                    this->sortColumns.front().descending = !this->sortColumns.front().descending;
+                }
+                else
+                {
+                    this->sortColumns.erase(std::remove_if(this->sortColumns.begin(), this->sortColumns.end(), [index](const SortColumn& column)
+                        { return column.category == index; }), this->sortColumns.end());
+
+                    this->sortColumns.insert(this->sortColumns.begin(), { index, false });
+                    if (this->sortColumns.size() > maxSortColumns)
+                        this->sortColumns.pop_back();
+                }
+
+                this->listOffset = 0;
+                this->InvalidateRows();
+            }
+        }
+
+        // Fetch the rows of the page if it has changed, then update the list buttons
+        this->BindVisibleRows();
+
+        for (VisibleRow& row : this->visibleRows)
         {
-            // Update the list buttons
-            this->listElements[index].button.Update(deltaTime, 8.0f);
+            row.button.Update(deltaTime, 8.0f);
 
             // Check if a list button has been clicked
-            if (this->listElements[index].button.WasClicked())
-                this->currentSelected = &this->listElements[index];
+            if (row.button.WasClicked())
+                this->currentSelected = row.element.value;
         }
 
-        // Update the page navigation buttons
+        // Update the page navigation buttons, the rows of the new page are fetched into the same row widgets
         if (this->listOffset > 0)
         {
             this->previousPageButton.Update(deltaTime, 8.0f);
             if (this->previousPageButton.WasClicked())
+            {
                 this->listOffset -= this->maxListSelectionsVisible;
+                this->rowsOutdated = true;
+            }
         }
 
-        if (this->listOffset + this->maxListSelectionsVisible < (int)this->listElements.size())
+        if (this->listOffset + this->maxListSelectionsVisible < (int)this->GetTotalRows())
         {
             this->nextPageButton.Update(deltaTime, 8.0f);
             if (this->nextPageButton.WasClicked())
+            {
                 this->listOffset += this->maxListSelectionsVisible;
+                this->rowsOutdated = true;
+            }
         }
     }
 }
 
 void SelectionList::Render(float masterOpacity) const
 {
+    // Rows changed since the last update are fetched now, so they don't show up a frame late
+    this->BindVisibleRows();
+
     // Render the list category identifier bar and its shadow
     Renderer::GetInstance().RenderSquare({ this->position.x + 5.0f, this->position.y - ((this->size.y - this->buttonHeight) / 2) + 5.0f },
         { this->size.x, this->buttonHeight }, { glm::vec3(0), (((this->opacity * masterOpacity) / 255.0f) * 0.5f) });
 
-    Renderer::GetInstance().RenderSquare({ this->position.x, this->position.y - ((this->size.y - this->buttonHeight) / 2) }, 
+    Renderer::GetInstance().RenderSquare({ this->position.x, this->position.y - ((this->size.y - this->buttonHeight) / 2) },
         { this->size.x, this->buttonHeight }, { glm::vec3(60), (this->opacity * masterOpacity) / 255.0f });
 
     // Render the list buttons
-    for (int index = this->listOffset; index < std::min(this->listOffset + this->maxListSelectionsVisible, (int)this->listElements.size()); index++)
-        this->listElements[index].button.Render(masterOpacity);
+    for (const VisibleRow& row : this->visibleRows)
+        row.button.Render(masterOpacity);
 
     // Render the category dividor lines
     for (int index = 1; index < this->listCategories.size(); index++)
@@ -123,25 +380,31 @@ void SelectionList::Render(float masterOpacity) const
     {
         const Category& category = this->listCategories[index];
 
-        Renderer::GetInstance().RenderText({ 
+        Renderer::GetInstance().RenderText({
             this->position.x - (this->size.x / 2) + (index * (this->size.x / (float)this->listCategories.size())) + textOffsetFromEdge,
             this->position.y - ((this->size.y - this->buttonHeight) / 2) + (category.textSize.y / 2) },
             { glm::vec3(255), (this->opacity * masterOpacity) / 255.0f }, this->font, (uint32_t)this->fontSize, category.text);
     }
 
-    // Render each list button's text
-    for (int index = this->listOffset; index < std::min(this->listOffset + this->maxListSelectionsVisible, (int)this->listElements.size()); index++)
+    // Render the arrow showing which category the list is sorted by, and in which direction
+    if (this->sortingEnabled && !this->sortColumns.empty())
     {
-        const Element& element = this->listElements[index];
+        const SortColumn& column = this->sortColumns.front();
+        Renderer::GetInstance().RenderTriangle({
+            this->position.x - (this->size.x / 2) + ((column.category + 1) * (this->size.x / (float)this->listCategories.size())) - textOffsetFromEdge,
+            this->position.y - ((this->size.y - this->buttonHeight) / 2) }, { this->buttonHeight / 4.0f, this->buttonHeight / 5.0f },
+            { glm::vec3(200), (this->opacity * masterOpacity) / 255.0f }, column.descending ? 0.0f : 180.0f);
+    }
 
-        for (int jIndex = 0; jIndex < element.categoryValues.size(); jIndex++)
+    // Render each list button's text
+    for (const VisibleRow& row : this->visibleRows)
+    {
+        for (int jIndex = 0; jIndex < row.element.categoryValues.size(); jIndex++)
         {
-            const Category& category = element.categoryValues[jIndex];
-
-            Renderer::GetInstance().RenderText({ 
+            Renderer::GetInstance().RenderText({
                 this->position.x - (this->size.x / 2) + (jIndex * (this->size.x / (float)this->listCategories.size())) + textOffsetFromEdge,
-                element.button.GetPosition().y + (category.textSize.y / 2) }, { glm::vec3(255), (this->opacity * masterOpacity) / 255.0f }, this->font, 
-                (uint32_t)this->fontSize, category.text);
+                row.button.GetPosition().y + (row.textSizes[jIndex].y / 2) }, { glm::vec3(255), (this->opacity * masterOpacity) / 255.0f }, this->font,
+                (uint32_t)this->fontSize, row.element.categoryValues[jIndex]);
         }
     }
 
@@ -149,12 +412,12 @@ void SelectionList::Render(float masterOpacity) const
     if (this->listOffset > 0)
     {
         this->previousPageButton.Render(masterOpacity);
-        Renderer::GetInstance().RenderTriangle({ this->previousPageButton.GetPosition().x - (this->previousPageButton.GetCurrentSize().x / 3.5f), 
-            this->previousPageButton.GetPosition().y }, { this->previousPageButton.GetCurrentSize().x / 1.5f, this->previousPageButton.GetCurrentSize().y }, 
+        Renderer::GetInstance().RenderTriangle({ this->previousPageButton.GetPosition().x - (this->previousPageButton.GetCurrentSize().x / 3.5f),
+            this->previousPageButton.GetPosition().y }, { this->previousPageButton.GetCurrentSize().x / 1.5f, this->previousPageButton.GetCurrentSize().y },
             { glm::vec3(40), (this->opacity * masterOpacity) / 255.0f }, 90);
     }
 
-    if (this->listOffset + this->maxListSelectionsVisible < (int)this->listElements.size())
+    if (this->listOffset + this->maxListSelectionsVisible < (int)this->GetTotalRows())
     {
         this->nextPageButton.Render(masterOpacity);
         Renderer::GetInstance().RenderTriangle({ this->nextPageButton.GetPosition().x + (this->nextPageButton.GetCurrentSize().x / 3.5f),
@@ -165,10 +428,12 @@ void SelectionList::Render(float masterOpacity) const
 
 int SelectionList::GetCurrentSelected() const
 {
-    if (this->currentSelected)
-        return this->currentSelected->value;
+    return this->currentSelected;
+}
 
-    return -1;
+size_t SelectionList::GetTotalRows() const
+{
+    return this->rowFetcher ? this->totalSourceRows : this->listElements.size();
 }
 
 std::vector<SelectionList::Element>& SelectionList::GetListElements()
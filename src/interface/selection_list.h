@@ -5,34 +5,116 @@
 #include <graphics/font_loader.h>
 #include <core/audio_system.h>
 
+#include <functional>
 #include <vector>
 
 class SelectionList
 {
+public:
+	// How the elements are compared when the list is sorted by a category
+	enum class SortType : uint8_t
+	{
+		TEXT, // Compared by the text shown
+		KEY // Compared by the sort key given along with the element
+	};
+
+	// A row of the list, either added to the list directly or fetched from the list's data source when it's shown
+	struct Element
+	{
+		std::vector<std::string> categoryValues;
+		std::vector<int64_t> sortKeys; // The values the element is sorted by in the categories sorted by key, indexed by category
+		int value = -1;
+		glm::vec3 baseColor = glm::vec3(85), highlightColor = glm::vec3(115), edgeColor = glm::vec3(60);
+	};
+
+	// Fills in the element given with the row at the index given.
+	using RowFetcher = std::function<void(size_t index, Element& element)>;
+
+	// Returns the sort key of the row at the index given in the category given, so sorting by a key doesn't have to fetch whole rows.
+	using SortKeyFetcher = std::function<int64_t(size_t index, int category)>;
+
+	// Returns the text of the row at the index given in the category given, so sorting by text doesn't have to fetch whole rows.
+	using SortTextFetcher = std::function<std::string(size_t index, int category)>;
 private:
 	struct Category
 	{
 		std::string text;
 		glm::vec2 textSize;
+		SortType sortType = SortType::TEXT;
 	};
-public:
-	struct Element
+
+	// A row widget of the page being shown, which is bound to another element whenever the page or the order of the list changes
+	struct VisibleRow
 	{
-		std::vector<Category> categoryValues;
+		Element element;
+		std::vector<glm::vec2> textSizes;
 		ButtonBase button;
-		int value;
 	};
-private:
+
+	// A category the list is sorted by, the list is sorted by the most recently clicked category first
+	struct SortColumn
+	{
+		int category;
+		bool descending;
+	};
+
+	// The values of a sorted category for every row, gathered once per sort so comparing rows doesn't have to fetch them
+	struct SortColumnValues
+	{
+		std::vector<int64_t> keys;
+		std::vector<std::string> texts;
+	};
+
 	FontPtr font;
 	glm::vec2 position, size;
 	float fontSize, buttonHeight, opacity;
-	int listOffset, maxListSelectionsVisible;
+	int listOffset, maxListSelectionsVisible, currentSelected;
 
 	std::vector<Category> listCategories;
 	std::vector<Element> listElements;
-	Element* currentSelected;
+
+	// When a data source is set, the rows are fetched from it rather than from the elements added to the list
+	RowFetcher rowFetcher;
+	SortKeyFetcher sortKeyFetcher;
+	SortTextFetcher sortTextFetcher;
+	size_t totalSourceRows;
 
 	ButtonBase nextPageButton, previousPageButton;
+
+	// Clicking a category's header sorts the list by it, only the rows up to the end of the page being shown are put in order
+	bool sortingEnabled;
+	std::vector<ButtonBase> categoryButtons;
+	std::vector<SortColumn> sortColumns;
+	mutable std::vector<SortColumnValues> sortValues; // Indexed the same as the sort columns
+	mutable std::vector<uint32_t> displayOrder; // The indices of the rows in the order they're shown, only used while the list is sorted
+	mutable size_t totalSorted; // The number of rows at the front of the display order which are in their final place
+	mutable bool orderOutdated;
+
+	// Only the rows of the page being shown are fetched and have their text measured
+	mutable std::vector<VisibleRow> visibleRows;
+	mutable bool rowsOutdated;
+private:
+	// Fills in the element given with the row at the index given.
+	void FetchRow(size_t index, Element& element) const;
+
+	// Gathers the values of every row in each of the categories the list is sorted by.
+	void GatherSortValues() const;
+
+	// Returns TRUE if the first row given comes before the second in the current sort order.
+	bool IsOrderedBefore(uint32_t firstIndex, uint32_t secondIndex) const;
+
+	// Puts the rows in their final place in the display order up to (but not including) the display position given.
+	// The remaining rows are partitioned around the end position first, so only the rows being shown have to be sorted.
+	void SortDisplayOrder(size_t end) const;
+
+	// Fetches the rows of the page being shown into the row widgets, if the page or the rows have changed since they were last fetched.
+	void BindVisibleRows() const;
+
+	// Flags the display order and the rows being shown as outdated, this must be called whenever the rows change.
+	void InvalidateRows();
+
+	// Returns the position of the list button in the row of the page given.
+	glm::vec2 GetRowPosition(int row) const;
 public:
 	SelectionList();
 	SelectionList(const glm::vec2& pos, const glm::vec2& size, float buttonHeight, float opacity = 255.0f, float fontSize = -1.0f);
@@ -43,16 +125,29 @@ public:
 	void SetOpacity(float opacity);
 
 	// Adds new category to the selection list.
-	void AddCategory(const std::string_view& name);
+	void AddCategory(const std::string_view& name, SortType sortType = SortType::TEXT);
+
+	// Sets whether the list can be sorted by clicking on the category headers.
+	void SetSortingEnabled(bool enabled);
 
 	// Adds new selection element to the selection list.
-	void AddElement(const std::vector<std::string>& categoryValues, int value, const glm::vec3& baseColor = glm::vec3(85), 
+	void AddElement(const std::vector<std::string>& categoryValues, int value, const glm::vec3& baseColor = glm::vec3(85),
 		const glm::vec3& highlightColor = glm::vec3(115), const glm::vec3& edgeColor = glm::vec3(60));
 
-	// Clears all selection elements from the selection list.
+	// Adds new selection element to the selection list, along with the keys it's sorted by in the categories sorted by key.
+	// The keys should be the underlying values (IDs, amounts, dates) rather than anything formatted for display.
+	void AddElement(const std::vector<std::string>& categoryValues, const std::vector<int64_t>& sortKeys, int value,
+		const glm::vec3& baseColor = glm::vec3(85), const glm::vec3& highlightColor = glm::vec3(115), const glm::vec3& edgeColor = glm::vec3(60));
+
+	// Replaces the elements of the list with the number of rows given, which are fetched with the row fetcher given only once they're
+	// shown. The sort fetchers are optional, without them the rows are fetched whole when the list is sorted by a key or by text.
+	void SetDataSource(size_t totalRows, const RowFetcher& rowFetcher, const SortKeyFetcher& sortKeyFetcher = nullptr, 
+		const SortTextFetcher& sortTextFetcher = nullptr);
+
+	// Clears all selection elements (and the data source) from the selection list.
 	void Clear();
 
-	// Resets the current selected element pointer to null.
+	// Resets the current selected element to none.
 	void Reset();
 
 	// Updates the selection list.
@@ -65,7 +160,10 @@ public:
 	// If no element in the list is selected, -1 is returned.
 	int GetCurrentSelected() const;
 
-	// Returns the vector containing the list elements.
+	// Returns the number of rows in the list, whether they were added as elements or come from the data source.
+	size_t GetTotalRows() const;
+
+	// Returns the vector containing the elements added to the list.
 	std::vector<Element>& GetListElements();
 
 	// Returns the position of the selection list.
@@ -61,14 +61,18 @@ void TextInputField::Update(const float& deltaTime)
             // Poll for any character that has been inputted
             const uint32_t character = InputSystem::GetInstance().GetInputtedCharacter();
 
-            // Accept only spaces, numerical and alphabetic characters based on the input restriction flags given
+            // Accept only spaces, numerical and alphabetic characters (and symbols if allowed) based on the input restriction flags given
             // Also only accept characters if the text box field is not full
             if (this->textSize.x + 30 < this->size.x - 40)
             {
+                const bool isNumeric = character >= 48 && character <= 57;
+                const bool isAlphabetic = (character >= 65 && character <= 90) || (character >= 97 && character <= 122);
+
                 if ((character == 32 && (this->inputFlags & Restrictions::NO_SPACES) != Restrictions::NO_SPACES) ||
-                    ((character >= 48 && character <= 57) && (this->inputFlags & Restrictions::NO_NUMERIC) != Restrictions::NO_NUMERIC) ||
-                    (((character >= 65 && character <= 90) || (character >= 97 && character <= 122)) &&
-                        (this->inputFlags & Restrictions::NO_ALPHABETIC) != Restrictions::NO_ALPHABETIC))
+                    (isNumeric && (this->inputFlags & Restrictions::NO_NUMERIC) != Restrictions::NO_NUMERIC) ||
+                    (isAlphabetic && (this->inputFlags & Restrictions::NO_ALPHABETIC) != Restrictions::NO_ALPHABETIC) ||
+                    ((character > 32 && character < 127 && !isNumeric && !isAlphabetic) &&
+                        (this->inputFlags & Restrictions::ALLOW_SYMBOLS) == Restrictions::ALLOW_SYMBOLS))
                 {
                     this->inputtedText.push_back((char)character);
                 }
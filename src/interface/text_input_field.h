@@ -13,7 +13,8 @@ public:
 		NONE = 0x0,
 		NO_ALPHABETIC = 0x1,
 		NO_NUMERIC = 0x2,
-		NO_SPACES = 0x4
+		NO_SPACES = 0x4,
+		ALLOW_SYMBOLS = 0x8 // Accepts printable symbols such as '<' and ':', which are otherwise rejected
 	};
 private:
 	FontPtr textFont;
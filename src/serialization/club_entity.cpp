@@ -1,5 +1,6 @@
 #include <serialization/club_entity.h>
 #include <serialization/save_data.h>
+#include <simulation/squad_optimizer.h>
 #include <util/logging_system.h>
 #include <util/random_engine.h>
 
@@ -57,19 +58,10 @@ void Club::GenerateObjectives()
     const League* currentLeague = SaveData::GetInstance().GetCurrentLeague();
 
     // Generate a fair league position objective
-    const std::vector<Club*>& leagueClubs = currentLeague->GetClubs();
-    const int clubOverall = this->GetAverageOverall();
+    CompetitionRankIndex& rankIndex = SaveData::GetInstance().GetCompetitionRankIndex();
+    const CompetitionRankIndex::RankCounts leagueCounts = rankIndex.GetRankCounts(currentLeague->GetID(), *this);
 
-    int numBetterClubs = 0, numEqualClubs = 0;
-    for (const Club* club : leagueClubs)
-    {
-        if (club->GetAverageOverall() > clubOverall)
-            ++numBetterClubs;
-        else if (club->GetAverageOverall() == clubOverall && club->GetID() != this->id)
-            ++numEqualClubs;
-    }
-
-    const int targetLeaguePosition = (numBetterClubs + 1) + RandomEngine::GetInstance().GenerateRandom<int>(0, numEqualClubs);
+    const int targetLeaguePosition = (leagueCounts.stronger + 1) + RandomEngine::GetInstance().GenerateRandom<int>(0, leagueCounts.equal);
 
     if (currentLeague->GetRelegationThreshold() != -1)
     {
@@ -87,31 +79,11 @@ void Club::GenerateObjectives()
         if (comp.competitionID >= 1000 && comp.competitionID <= 1003) 
             continue;
 
-        // Total up all the better and equal clubs that compete in the same cup competition
-        int totalClubsInComp = numBetterClubs = numEqualClubs = 0;
-
-        for (const League& league : SaveData::GetInstance().GetLeagueDatabase())
-        {
-            for (const League::CompetitionLink& compLink : league.GetLinkedCompetitions())
-            {
-                if (comp.competitionID == compLink.competitionID)
-                {
-                    for (const Club* club : league.GetClubs())
-                    {
-                        if (club->GetAverageOverall() > clubOverall)
-                            ++numBetterClubs;
-                        else if (club->GetAverageOverall() == clubOverall && club->GetID() != this->id)
-                            ++numEqualClubs;
-                    }
-
-                    totalClubsInComp += (int)league.GetClubs().size();
-                    break;
-                }
-            }
-        }
+        // Fetch the number of better and equal clubs that compete in the same cup competition
+        const CompetitionRankIndex::RankCounts cupCounts = rankIndex.GetRankCounts(comp.competitionID, *this);
 
         // If there is less than (or equal to) 6 similar high achieving teams, then the target should be to win the cup
-        const int totalHigherAchievingClubs = (numBetterClubs + RandomEngine::GetInstance().GenerateRandom<int>(0, numEqualClubs));
+        const int totalHigherAchievingClubs = (cupCounts.stronger + RandomEngine::GetInstance().GenerateRandom<int>(0, cupCounts.equal));
         const int targetEndRound = totalHigherAchievingClubs <= 6 ? (int)(SaveData::GetInstance().GetCup(comp.competitionID)->GetRounds().size() + 1) :
             std::max((int)(SaveData::GetInstance().GetCup(comp.competitionID)->GetRounds().size() - std::log2(std::max(totalHigherAchievingClubs, 1))), 3);
 
@@ -138,6 +110,9 @@ void Club::AddPlayer(Player* player)
     // Add the player to the club
     player->SetClub(this->id);
     this->players.emplace_back(player);
+
+    SaveData::GetInstance().GetClubIndex().Refresh(*this);
+    SaveData::GetInstance().GetCompetitionRankIndex().Refresh(*this);
 }
 
 void Club::RemovePlayer(Player* player)
@@ -151,6 +126,8 @@ void Club::RemovePlayer(Player* player)
         if ((*iterator)->GetID() == player->GetID())
         {
             this->players.erase(iterator);
+            SaveData::GetInstance().GetClubIndex().Refresh(*this);
+            SaveData::GetInstance().GetCompetitionRankIndex().Refresh(*this);
             return;
         }
     }
@@ -162,17 +139,9 @@ void Club::RemovePlayer(Player* player)
 
 int Club::GetAverageOverall() const
 {
-    if (this->players.size() >= 11)
-    {
-        // Only the top 11 players are taken into account, we assume those players are in the starting 11 of the club
-        int overallTotal = 0;
-        for (size_t index = 0; index < 11; index++)
-            overallTotal += this->players[index]->GetOverall();
-
-        return overallTotal / 11;
-    }
-
-    return -1; // This club most likely isn't in the game so return -1
+    // Only the players in the club's best starting 11 are taken into account, with each player rated in the position they're picked for.
+    // If the club has fewer than 11 players then it most likely isn't in the game, in which case -1 is returned.
+    return SquadOptimizer::GetBestLineup(*this).GetAverageRating();
 }
 
 Club::TrainingStaff& Club::GetTrainingStaff(Club::StaffType type)
@@ -220,6 +189,11 @@ std::vector<Player*>& Club::GetPlayers()
     return this->players;
 }
 
+const std::vector<Player*>& Club::GetPlayers() const
+{
+    return this->players;
+}
+
 std::vector<Club::GeneralMessage>& Club::GetGeneralMessages()
 {
     return this->generalMessages;
@@ -285,7 +259,7 @@ const int Club::GetTotalGoalkeepers() const
     int count = 0;
     for (const Player* player : this->players)
     {
-        if (player->GetPosition() == 0)
+        if (SaveData::GetInstance().GetPositionTraits(player->GetPosition()).goalkeeper)
             ++count;
     }
 
@@ -84,7 +84,7 @@ public:
 	// Removes player given from the club.
 	void RemovePlayer(Player* player);
 
-	// Returns the average overall of the players in the club.
+	// Returns the average rating of the players in the club's best starting 11, or -1 if the club has fewer than 11 players.
 	int GetAverageOverall() const;
 
 	// Returns the current hired training staff at the club.
@@ -102,6 +102,9 @@ public:
 	// Returns players in the club.
 	std::vector<Player*>& GetPlayers();
 
+	// Returns players in the club.
+	const std::vector<Player*>& GetPlayers() const;
+
 	// Returns the club's general messages inbox.
 	std::vector<GeneralMessage>& GetGeneralMessages();
 
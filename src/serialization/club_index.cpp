@@ -0,0 +1,143 @@
+#include <serialization/club_index.h>
+#include <serialization/save_data.h>
+#include <util/random_engine.h>
+#include <util/globals.h>
+
+#include <algorithm>
+
+ClubIndex::ClubIndex() :
+    outdated(true)
+{}
+
+size_t ClubIndex::GetBucketIndex(int averageOverall)
+{
+    return (size_t)std::clamp(averageOverall + 1, 0, ClubIndex::bucketCount - 1);
+}
+
+bool ClubIndex::IsEligible(const Club& club) const
+{
+    if (club.GetPlayers().size() >= Globals::maxSquadSize)
+        return false;
+
+    for (UserProfile& user : SaveData::GetInstance().GetUsers())
+    {
+        if (user.GetClub()->GetID() == club.GetID())
+            return false;
+    }
+
+    return true;
+}
+
+void ClubIndex::Insert(Club* club)
+{
+    const size_t bucket = ClubIndex::GetBucketIndex(club->GetAverageOverall());
+
+    this->locations[club->GetID()] = { bucket, this->buckets[bucket].size() };
+    this->buckets[bucket].emplace_back(club);
+}
+
+void ClubIndex::Erase(uint16_t clubID)
+{
+    auto iterator = this->locations.find(clubID);
+    if (iterator == this->locations.end())
+        return;
+
+    // Swap the club with the last club in its bucket then pop it off, so the removal doesn't have to shift the rest of the bucket
+    std::vector<Club*>& bucket = this->buckets[iterator->second.bucket];
+    const size_t index = iterator->second.index;
+
+    if (index != bucket.size() - 1)
+    {
+        bucket[index] = bucket.back();
+        this->locations[bucket[index]->GetID()].index = index;
+    }
+
+    bucket.pop_back();
+    this->locations.erase(iterator);
+}
+
+void ClubIndex::Invalidate()
+{
+    this->outdated = true;
+}
+
+void ClubIndex::Rebuild()
+{
+    for (std::vector<Club*>& bucket : this->buckets)
+        bucket.clear();
+
+    this->locations.clear();
+
+    for (Club& club : SaveData::GetInstance().GetClubDatabase())
+    {
+        if (this->IsEligible(club))
+            this->Insert(&club);
+    }
+
+    this->outdated = false;
+}
+
+void ClubIndex::Refresh(Club& club)
+{
+    // There's no point updating an index which is going to be rebuilt anyway
+    if (this->outdated)
+        return;
+
+    this->Erase(club.GetID());
+
+    if (this->IsEligible(club))
+        this->Insert(&club);
+}
+
+Club* ClubIndex::GetRandomClub(int minAverageOverall, int maxAverageOverall, const std::function<bool(const Club&)>& filter)
+{
+    if (this->outdated)
+        this->Rebuild();
+
+    const size_t firstBucket = ClubIndex::GetBucketIndex(minAverageOverall), lastBucket = ClubIndex::GetBucketIndex(maxAverageOverall);
+    const int totalClubs = (int)this->GetTotalClubs(minAverageOverall, maxAverageOverall);
+
+    // Draw clubs from the range without replacement (a partial Fisher-Yates shuffle over the virtual list of clubs in the range), so clubs 
+    // rejected by the filter are never drawn twice and it is known straight away once every club in the range has been rejected
+    std::unordered_map<int, int> swappedIndices;
+    for (int remaining = totalClubs; remaining > 0; remaining--)
+    {
+        const int drawnIndex = RandomEngine::GetInstance().GenerateRandom<int>(0, remaining - 1);
+
+        auto drawnIterator = swappedIndices.find(drawnIndex);
+        int clubIndex = (drawnIterator != swappedIndices.end()) ? drawnIterator->second : drawnIndex;
+
+        auto lastIterator = swappedIndices.find(remaining - 1);
+        swappedIndices[drawnIndex] = (lastIterator != swappedIndices.end()) ? lastIterator->second : remaining - 1;
+
+        // Convert the virtual index into the club it refers to
+        Club* club = nullptr;
+        for (size_t bucket = firstBucket; bucket <= lastBucket; bucket++)
+        {
+            if (clubIndex < (int)this->buckets[bucket].size())
+            {
+                club = this->buckets[bucket][clubIndex];
+                break;
+            }
+
+            clubIndex -= (int)this->buckets[bucket].size();
+        }
+
+        if (!filter || filter(*club))
+            return club;
+    }
+
+    return nullptr;
+}
+
+size_t ClubIndex::GetTotalClubs(int minAverageOverall, int maxAverageOverall)
+{
+    if (this->outdated)
+        this->Rebuild();
+
+    size_t totalClubs = 0;
+    for (size_t bucket = ClubIndex::GetBucketIndex(minAverageOverall); bucket <= ClubIndex::GetBucketIndex(maxAverageOverall); bucket++)
+        totalClubs += this->buckets[bucket].size();
+
+    return totalClubs;
+}
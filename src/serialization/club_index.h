@@ -0,0 +1,60 @@
+#ifndef CLUB_INDEX_H
+#define CLUB_INDEX_H
+
+#include <cstdint>
+#include <array>
+#include <vector>
+#include <unordered_map>
+#include <functional>
+
+class Club;
+
+class ClubIndex
+{
+private:
+	struct Location
+	{
+		size_t bucket, index;
+	};
+
+	// One bucket per possible average overall, offset by one so clubs with too few players (average overall of -1) go into bucket 0
+	static constexpr int bucketCount = 101;
+
+	std::array<std::vector<Club*>, bucketCount> buckets;
+	std::unordered_map<uint16_t, Location> locations;
+	bool outdated;
+private:
+	// Returns the bucket index matching the average overall given.
+	static size_t GetBucketIndex(int averageOverall);
+
+	// Returns TRUE if the club given is AI controlled and has space in its squad for another player, else FALSE is returned.
+	bool IsEligible(const Club& club) const;
+
+	// Inserts the club given into the bucket matching its average overall.
+	void Insert(Club* club);
+
+	// Removes the club matching the ID given from the index, if it is in the index.
+	void Erase(uint16_t clubID);
+public:
+	ClubIndex();
+	~ClubIndex() = default;
+
+	// Flags the index as outdated, so it is rebuilt the next time it is queried.
+	// This must be called whenever the club database is reloaded, the users' clubs change or players' overalls change.
+	void Invalidate();
+
+	// Rebuilds the index from the save's club database.
+	void Rebuild();
+
+	// Updates the position of the club given in the index, this should be called whenever a club's squad changes.
+	void Refresh(Club& club);
+
+	// Returns a uniformly chosen AI controlled club, which has squad space and an average overall within the specified range (inclusive), and 
+	// passes the filter given. If there is no such club, then nullptr is returned.
+	Club* GetRandomClub(int minAverageOverall, int maxAverageOverall, const std::function<bool(const Club&)>& filter = nullptr);
+
+	// Returns the number of AI controlled clubs with squad space and an average overall within the specified range (inclusive).
+	size_t GetTotalClubs(int minAverageOverall, int maxAverageOverall);
+};
+
+#endif
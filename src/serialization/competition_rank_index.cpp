@@ -0,0 +1,125 @@
+#include <serialization/competition_rank_index.h>
+#include <serialization/save_data.h>
+
+#include <algorithm>
+
+bool CompetitionRankIndex::Entry::operator<(const Entry& other) const
+{
+    if (this->averageOverall != other.averageOverall)
+        return this->averageOverall < other.averageOverall;
+
+    return this->clubID < other.clubID;
+}
+
+CompetitionRankIndex::CompetitionRankIndex() :
+    outdated(true)
+{}
+
+void CompetitionRankIndex::AddToCompetition(uint16_t competitionID, const Club& club)
+{
+    std::vector<uint16_t>& clubCompetitions = this->clubCompetitions[club.GetID()];
+    if (std::find(clubCompetitions.begin(), clubCompetitions.end(), competitionID) != clubCompetitions.end())
+        return;
+
+    clubCompetitions.emplace_back(competitionID);
+    this->competitions[competitionID].push_back({ this->clubOveralls[club.GetID()], club.GetID() });
+}
+
+void CompetitionRankIndex::Invalidate()
+{
+    this->outdated = true;
+}
+
+void CompetitionRankIndex::Rebuild()
+{
+    this->competitions.clear();
+    this->clubOveralls.clear();
+    this->clubCompetitions.clear();
+
+    for (const Club& club : SaveData::GetInstance().GetClubDatabase())
+    {
+        if (club.GetID() >= this->clubOveralls.size())
+        {
+            this->clubOveralls.resize(club.GetID() + 1, -1);
+            this->clubCompetitions.resize(club.GetID() + 1);
+        }
+
+        this->clubOveralls[club.GetID()] = club.GetAverageOverall();
+    }
+
+    // Every club in a league takes part in the league itself and every competition linked to the league
+    for (const League& league : SaveData::GetInstance().GetLeagueDatabase())
+    {
+        for (const Club* club : league.GetClubs())
+        {
+            this->AddToCompetition(league.GetID(), *club);
+
+            for (const League::CompetitionLink& compLink : league.GetLinkedCompetitions())
+                this->AddToCompetition(compLink.competitionID, *club);
+        }
+    }
+
+    for (auto& [competitionID, entries] : this->competitions)
+        std::sort(entries.begin(), entries.end());
+
+    this->outdated = false;
+}
+
+void CompetitionRankIndex::Refresh(const Club& club)
+{
+    // An outdated index picks up the change when it is rebuilt
+    if (this->outdated || club.GetID() >= this->clubOveralls.size())
+        return;
+
+    const int previousOverall = this->clubOveralls[club.GetID()];
+    const int currentOverall = club.GetAverageOverall();
+
+    if (previousOverall == currentOverall)
+        return;
+
+    // Move the club's entry to its new place in each of its competitions
+    for (uint16_t competitionID : this->clubCompetitions[club.GetID()])
+    {
+        std::vector<Entry>& entries = this->competitions[competitionID];
+
+        auto iterator = std::lower_bound(entries.begin(), entries.end(), Entry{ previousOverall, club.GetID() });
+        if (iterator != entries.end() && iterator->clubID == club.GetID())
+            entries.erase(iterator);
+
+        const Entry entry = { currentOverall, club.GetID() };
+        entries.insert(std::upper_bound(entries.begin(), entries.end(), entry), entry);
+    }
+
+    this->clubOveralls[club.GetID()] = currentOverall;
+}
+
+CompetitionRankIndex::RankCounts CompetitionRankIndex::GetRankCounts(uint16_t competitionID, const Club& club)
+{
+    if (this->outdated)
+        this->Rebuild();
+    else
+        this->Refresh(club);
+
+    RankCounts counts;
+
+    auto competitionIterator = this->competitions.find(competitionID);
+    if (competitionIterator == this->competitions.end())
+        return counts;
+
+    const std::vector<Entry>& entries = competitionIterator->second;
+    const int clubOverall = club.GetAverageOverall();
+
+    // Entries are ordered by overall then club ID, so the clubs with the same overall sit between the lowest and highest possible IDs
+    auto firstEqual = std::lower_bound(entries.begin(), entries.end(), Entry{ clubOverall, 0 });
+    auto firstStronger = std::upper_bound(entries.begin(), entries.end(), Entry{ clubOverall, UINT16_MAX });
+
+    counts.stronger = (int)(entries.end() - firstStronger);
+    counts.equal = (int)(firstStronger - firstEqual);
+    counts.total = (int)entries.size();
+
+    // Don't count the club as being as strong as itself
+    if (std::binary_search(firstEqual, firstStronger, Entry{ clubOverall, club.GetID() }))
+        --counts.equal;
+
+    return counts;
+}
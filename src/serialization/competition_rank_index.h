@@ -0,0 +1,54 @@
+#ifndef COMPETITION_RANK_INDEX_H
+#define COMPETITION_RANK_INDEX_H
+
+#include <cstdint>
+#include <vector>
+#include <unordered_map>
+
+class Club;
+
+class CompetitionRankIndex
+{
+public:
+	struct RankCounts
+	{
+		int stronger = 0, equal = 0, total = 0;
+	};
+private:
+	struct Entry
+	{
+		int averageOverall;
+		uint16_t clubID;
+
+		bool operator<(const Entry& other) const;
+	};
+
+	// The clubs taking part in each competition (keyed by league or cup ID), sorted by average overall in ascending order
+	std::unordered_map<uint16_t, std::vector<Entry>> competitions;
+
+	std::vector<int> clubOveralls; // The average overall each club is currently indexed with, indexed by club ID
+	std::vector<std::vector<uint16_t>> clubCompetitions; // The competitions each club takes part in, indexed by club ID
+	bool outdated;
+private:
+	// Adds the club given to the competition matching the ID given.
+	void AddToCompetition(uint16_t competitionID, const Club& club);
+public:
+	CompetitionRankIndex();
+	~CompetitionRankIndex() = default;
+
+	// Flags the index as outdated, so it is rebuilt the next time it is queried.
+	// This must be called whenever the club or league databases are reloaded, or a club moves to another league.
+	void Invalidate();
+
+	// Rebuilds the index from the save's league and club databases.
+	void Rebuild();
+
+	// Updates the average overall the club given is ranked by, this should be called whenever a club's squad or players' overalls change.
+	void Refresh(const Club& club);
+
+	// Returns the number of clubs in the competition matching the ID given which are stronger than, or as strong as, the club given.
+	// The club given is never counted as one of the equally strong clubs.
+	RankCounts GetRankCounts(uint16_t competitionID, const Club& club);
+};
+
+#endif
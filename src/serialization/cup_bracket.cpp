@@ -0,0 +1,81 @@
+#include <serialization/cup_bracket.h>
+
+#include <unordered_set>
+
+void CupBracket::Reset(const std::vector<uint16_t>& entrants)
+{
+    this->entrants = entrants;
+    this->rounds.clear();
+}
+
+void CupBracket::AddRound(const std::vector<Tie>& ties)
+{
+    this->rounds.emplace_back(ties);
+}
+
+void CupBracket::ReplaceClub(size_t fromRound, uint16_t clubID, uint16_t replacementID)
+{
+    for (size_t round = fromRound; round < this->rounds.size(); round++)
+    {
+        for (Tie& tie : this->rounds[round])
+        {
+            if (tie.homeClubID == clubID)
+                tie.homeClubID = replacementID;
+            else if (tie.awayClubID == clubID)
+                tie.awayClubID = replacementID;
+        }
+    }
+}
+
+CupBracket::Tie* CupBracket::GetTie(size_t round, uint16_t clubID)
+{
+    if (round >= this->rounds.size())
+        return nullptr;
+
+    for (Tie& tie : this->rounds[round])
+    {
+        if (tie.homeClubID == clubID || tie.awayClubID == clubID)
+            return &tie;
+    }
+
+    return nullptr;
+}
+
+std::vector<uint16_t> CupBracket::GetRemainingClubs() const
+{
+    std::unordered_set<uint16_t> eliminatedClubs;
+    for (const std::vector<Tie>& round : this->rounds)
+    {
+        for (const Tie& tie : round)
+            eliminatedClubs.insert(tie.homeWon ? tie.awayClubID : tie.homeClubID);
+    }
+
+    std::vector<uint16_t> remainingClubs;
+    for (uint16_t clubID : this->entrants)
+    {
+        if (eliminatedClubs.count(clubID) == 0)
+            remainingClubs.emplace_back(clubID);
+    }
+
+    return remainingClubs;
+}
+
+const std::vector<uint16_t>& CupBracket::GetEntrants() const
+{
+    return this->entrants;
+}
+
+const std::vector<std::vector<CupBracket::Tie>>& CupBracket::GetRounds() const
+{
+    return this->rounds;
+}
+
+int CupBracket::GetRoundsPlayed() const
+{
+    return (int)this->rounds.size();
+}
+
+bool CupBracket::IsDrawn() const
+{
+    return !this->entrants.empty();
+}
@@ -0,0 +1,52 @@
+#ifndef CUP_BRACKET_H
+#define CUP_BRACKET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class CupBracket
+{
+public:
+	struct Tie
+	{
+		uint16_t homeClubID = 0, awayClubID = 0;
+		bool homeWon = false;
+	};
+private:
+	std::vector<uint16_t> entrants; // Ordered by seed, the highest seed first
+	std::vector<std::vector<Tie>> rounds; // The ties of each round played so far, clubs without a tie in a round had a bye
+public:
+	CupBracket() = default;
+	~CupBracket() = default;
+
+	// Clears the bracket and enters the clubs given, the clubs should be ordered by seed.
+	void Reset(const std::vector<uint16_t>& entrants);
+
+	// Adds the ties of the next round to the bracket.
+	void AddRound(const std::vector<Tie>& ties);
+
+	// Hands the club's place in the bracket over to the replacement club, for every round from the round index given onwards.
+	void ReplaceClub(size_t fromRound, uint16_t clubID, uint16_t replacementID);
+
+	// Returns the tie the club played in the round index given.
+	// If the club didn't play in the round, then nullptr is returned.
+	Tie* GetTie(size_t round, uint16_t clubID);
+
+	// Returns the clubs which haven't been knocked out yet, ordered by seed.
+	std::vector<uint16_t> GetRemainingClubs() const;
+
+	// Returns the entrants of the cup, ordered by seed.
+	const std::vector<uint16_t>& GetEntrants() const;
+
+	// Returns the ties of every round played so far.
+	const std::vector<std::vector<Tie>>& GetRounds() const;
+
+	// Returns the number of rounds played so far.
+	int GetRoundsPlayed() const;
+
+	// Returns TRUE if the entrants of the cup have been drawn.
+	bool IsDrawn() const;
+};
+
+#endif
@@ -52,4 +52,14 @@ const int& KnockoutCup::GetWinnerBonus() const
 const int& KnockoutCup::GetTier() const
 {
     return this->tier;
+}
+
+CupBracket& KnockoutCup::GetBracket()
+{
+    return this->bracket;
+}
+
+const CupBracket& KnockoutCup::GetBracket() const
+{
+    return this->bracket;
 }
\ No newline at end of file
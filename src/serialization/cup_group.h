@@ -1,6 +1,7 @@
 #ifndef CUP_GROUP_H
 #define CUP_GROUP_H
 
+#include <serialization/cup_bracket.h>
 #include <string>
 #include <vector>
 
@@ -11,6 +12,8 @@ private:
 	std::string name, region;
 	std::vector<std::string> rounds;
 	int tier, winnerBonus;
+
+	CupBracket bracket;
 public:
 	KnockoutCup();
 	KnockoutCup(uint16_t id, const std::string_view& name, const std::string_view& region, const std::vector<std::string>& rounds, int winnerBonus, 
@@ -44,6 +47,12 @@ public:
 
 	// Returns the tier of the cup competition.
 	const int& GetTier() const;
+
+	// Returns the cup's bracket for the current season.
+	CupBracket& GetBracket();
+
+	// Returns the cup's bracket for the current season.
+	const CupBracket& GetBracket() const;
 };
 
 #endif
\ No newline at end of file
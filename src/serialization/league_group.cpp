@@ -1,4 +1,5 @@
 #include <serialization/league_group.h>
+#include <serialization/save_data.h>
 #include <util/logging_system.h>
 
 #include <cassert>
@@ -10,7 +11,7 @@ League::League() :
 League::League(const std::string_view& name, const std::string_view& nation, uint16_t id, uint16_t tier, int autoPromotion, int playoffs, int relegation,
     int titleBonus, const std::vector<CompetitionLink>& linkedComps, const std::vector<Club*> clubs, bool supported) :
     name(name), nation(nation), id(id), tier(tier), autoPromotion(autoPromotion), playoffs(playoffs), relegation(relegation), titleBonus(titleBonus), 
-    clubs(clubs), linkedCompetitions(linkedComps), supported(supported)
+    linkedCompetitions(linkedComps), clubs(clubs), table(clubs), supported(supported)
 {}
 
 void League::SetName(const std::string_view& name)
@@ -67,6 +68,8 @@ void League::AddClub(Club* club)
     // Add the club to the league
     club->SetLeague(this->id);
     this->clubs.emplace_back(club);
+
+    SaveData::GetInstance().GetCompetitionRankIndex().Invalidate();
 }
 
 void League::RemoveClub(Club* club)
@@ -80,6 +83,7 @@ void League::RemoveClub(Club* club)
         if ((*iterator)->GetID() == club->GetID())
         {
             this->clubs.erase(iterator);
+            SaveData::GetInstance().GetCompetitionRankIndex().Invalidate();
             return;
         }
     }
@@ -108,6 +112,16 @@ const std::vector<Club*>& League::GetClubs() const
     return this->clubs;
 }
 
+LeagueTable& League::GetTable()
+{
+    return this->table;
+}
+
+const LeagueTable& League::GetTable() const
+{
+    return this->table;
+}
+
 std::string_view League::GetName() const
 {
     return this->name;
@@ -2,6 +2,7 @@
 #define LEAGUE_GROUP_H
 
 #include <serialization/club_entity.h>
+#include <serialization/league_table.h>
 #include <vector>
 
 class League
@@ -19,6 +20,7 @@ private:
 
 	std::vector<CompetitionLink> linkedCompetitions;
 	std::vector<Club*> clubs;
+	LeagueTable table;
 	bool supported;
 public:
 	League();
@@ -63,6 +65,12 @@ public:
 	// Returns the clubs in the league.
 	const std::vector<Club*>& GetClubs() const;
 
+	// Returns the league's table of standings for the current season.
+	LeagueTable& GetTable();
+
+	// Returns the league's table of standings for the current season.
+	const LeagueTable& GetTable() const;
+
 	// Returns the name of the league.
 	std::string_view GetName() const;
 
@@ -0,0 +1,160 @@
+#include <serialization/league_table.h>
+#include <util/logging_system.h>
+
+#include <utility>
+
+int LeagueTable::Standing::GetPlayed() const
+{
+    return this->wins + this->draws + this->losses;
+}
+
+int LeagueTable::Standing::GetPoints() const
+{
+    return (this->wins * 3) + this->draws;
+}
+
+int LeagueTable::Standing::GetGoalDifference() const
+{
+    return this->scored - this->conceded;
+}
+
+LeagueTable::LeagueTable() :
+    roundsPlayed(0)
+{}
+
+LeagueTable::LeagueTable(const std::vector<Club*>& clubs) :
+    roundsPlayed(0)
+{
+    this->Reset(clubs);
+}
+
+bool LeagueTable::RanksAbove(const Standing& first, const Standing& second)
+{
+    // Clubs are ranked by points, then goal difference, then goals scored. The club ID is the final tie breaker so the order is always
+    // the same for the same set of results.
+    if (first.GetPoints() != second.GetPoints())
+        return first.GetPoints() > second.GetPoints();
+
+    if (first.GetGoalDifference() != second.GetGoalDifference())
+        return first.GetGoalDifference() > second.GetGoalDifference();
+
+    if (first.scored != second.scored)
+        return first.scored > second.scored;
+
+    return first.clubID < second.clubID;
+}
+
+void LeagueTable::Reposition(size_t index)
+{
+    while (index > 0 && LeagueTable::RanksAbove(this->standings[index], this->standings[index - 1]))
+    {
+        std::swap(this->standings[index], this->standings[index - 1]);
+        this->positions[this->standings[index].clubID] = index;
+        this->positions[this->standings[index - 1].clubID] = index - 1;
+        --index;
+    }
+
+    while (index + 1 < this->standings.size() && LeagueTable::RanksAbove(this->standings[index + 1], this->standings[index]))
+    {
+        std::swap(this->standings[index], this->standings[index + 1]);
+        this->positions[this->standings[index].clubID] = index;
+        this->positions[this->standings[index + 1].clubID] = index + 1;
+        ++index;
+    }
+}
+
+void LeagueTable::Reset(const std::vector<Club*>& clubs)
+{
+    this->standings.clear();
+    this->positions.clear();
+    this->roundsPlayed = 0;
+
+    for (const Club* club : clubs)
+    {
+        Standing standing;
+        standing.clubID = club->GetID();
+        this->SetStanding(standing);
+    }
+}
+
+void LeagueTable::RecordResult(uint16_t homeClubID, uint16_t awayClubID, int homeGoals, int awayGoals)
+{
+    auto homeIterator = this->positions.find(homeClubID);
+    auto awayIterator = this->positions.find(awayClubID);
+
+    if (homeIterator == this->positions.end() || awayIterator == this->positions.end())
+    {
+        LogSystem::GetInstance().OutputLog("The result couldn't be recorded since a club isn't in the league table (Club IDs: " +
+            std::to_string(homeClubID) + ", " + std::to_string(awayClubID) + ")", Severity::WARNING);
+        return;
+    }
+
+    // Only one standing can be out of place for the table to be reordered by moving it, so each club's standing is updated and
+    // repositioned in turn
+    auto updateStanding = [this](size_t index, int scored, int conceded)
+    {
+        Standing& standing = this->standings[index];
+        standing.scored += scored;
+        standing.conceded += conceded;
+
+        if (scored > conceded)
+            ++standing.wins;
+        else if (scored < conceded)
+            ++standing.losses;
+        else
+            ++standing.draws;
+
+        this->Reposition(index);
+    };
+
+    updateStanding(homeIterator->second, homeGoals, awayGoals);
+    updateStanding(awayIterator->second, awayGoals, homeGoals);
+}
+
+void LeagueTable::SetStanding(const Standing& standing)
+{
+    auto iterator = this->positions.find(standing.clubID);
+    if (iterator == this->positions.end())
+    {
+        this->positions[standing.clubID] = this->standings.size();
+        this->standings.emplace_back(standing);
+        this->Reposition(this->standings.size() - 1);
+        return;
+    }
+
+    this->standings[iterator->second] = standing;
+    this->Reposition(iterator->second);
+}
+
+void LeagueTable::SetRoundsPlayed(int rounds)
+{
+    this->roundsPlayed = rounds;
+}
+
+const LeagueTable::Standing* LeagueTable::GetStanding(uint16_t clubID) const
+{
+    auto iterator = this->positions.find(clubID);
+    if (iterator == this->positions.end())
+        return nullptr;
+
+    return &this->standings[iterator->second];
+}
+
+int LeagueTable::GetPosition(uint16_t clubID) const
+{
+    auto iterator = this->positions.find(clubID);
+    if (iterator == this->positions.end())
+        return -1;
+
+    return (int)iterator->second + 1;
+}
+
+const std::vector<LeagueTable::Standing>& LeagueTable::GetStandings() const
+{
+    return this->standings;
+}
+
+const int& LeagueTable::GetRoundsPlayed() const
+{
+    return this->roundsPlayed;
+}
@@ -0,0 +1,69 @@
+#ifndef LEAGUE_TABLE_H
+#define LEAGUE_TABLE_H
+
+#include <serialization/club_entity.h>
+#include <unordered_map>
+#include <vector>
+
+class LeagueTable
+{
+public:
+	struct Standing
+	{
+		uint16_t clubID = 0;
+		int wins = 0, draws = 0, losses = 0, scored = 0, conceded = 0;
+
+		// Returns the number of games the club has played.
+		int GetPlayed() const;
+
+		// Returns the number of points the club has earned.
+		int GetPoints() const;
+
+		// Returns the club's goal difference.
+		int GetGoalDifference() const;
+	};
+private:
+	std::vector<Standing> standings; // Always kept ordered by table position
+	std::unordered_map<uint16_t, size_t> positions; // Maps a club ID to the index of its standing
+	int roundsPlayed;
+private:
+	// Returns TRUE if the first standing ranks above the second standing in the table.
+	static bool RanksAbove(const Standing& first, const Standing& second);
+
+	// Moves the standing at the index given up or down the table until the table is ordered again.
+	// Only the standings it moves past are touched, so updating a table after a result is proportional to how far the club moves.
+	void Reposition(size_t index);
+public:
+	LeagueTable();
+	LeagueTable(const std::vector<Club*>& clubs);
+
+	~LeagueTable() = default;
+
+	// Clears the table and gives each of the clubs given an empty standing.
+	void Reset(const std::vector<Club*>& clubs);
+
+	// Records the result of a match between the two clubs given.
+	void RecordResult(uint16_t homeClubID, uint16_t awayClubID, int homeGoals, int awayGoals);
+
+	// Overwrites the standing of the club given, the club is added to the table if it isn't already in it.
+	void SetStanding(const Standing& standing);
+
+	// Sets the number of rounds of fixtures which have been played.
+	void SetRoundsPlayed(int rounds);
+
+	// Returns the standing of the club matching the ID given.
+	// If the club isn't in the table, then nullptr is returned.
+	const Standing* GetStanding(uint16_t clubID) const;
+
+	// Returns the table position (starting from 1) of the club matching the ID given.
+	// If the club isn't in the table, then -1 is returned.
+	int GetPosition(uint16_t clubID) const;
+
+	// Returns the standings ordered by table position.
+	const std::vector<Standing>& GetStandings() const;
+
+	// Returns the number of rounds of fixtures which have been played.
+	const int& GetRoundsPlayed() const;
+};
+
+#endif
@@ -0,0 +1,323 @@
+#include <serialization/name_index.h>
+#include <serialization/save_data.h>
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+
+namespace
+{
+    // The first code point in the table of folded Latin letters
+    constexpr uint32_t firstFoldedCodePoint = 0xC0;
+
+    // The unaccented upper case form of every code point from U+00C0 to U+017F (Latin-1 Supplement and Latin Extended-A letters).
+    // An empty entry means the character isn't a letter and is kept as it is.
+    constexpr std::array<std::string_view, 192> foldedLatinLetters = {
+        "A", "A", "A", "A", "A", "A", "AE", "C", "E", "E", "E", "E", "I", "I", "I", "I",
+        "D", "N", "O", "O", "O", "O", "O", "", "O", "U", "U", "U", "U", "Y", "TH", "SS",
+        "A", "A", "A", "A", "A", "A", "AE", "C", "E", "E", "E", "E", "I", "I", "I", "I",
+        "D", "N", "O", "O", "O", "O", "O", "", "O", "U", "U", "U", "U", "Y", "TH", "Y",
+        "A", "A", "A", "A", "A", "A", "C", "C", "C", "C", "C", "C", "C", "C", "D", "D",
+        "D", "D", "E", "E", "E", "E", "E", "E", "E", "E", "E", "E", "G", "G", "G", "G",
+        "G", "G", "G", "G", "H", "H", "H", "H", "I", "I", "I", "I", "I", "I", "I", "I",
+        "I", "I", "IJ", "IJ", "J", "J", "K", "K", "K", "L", "L", "L", "L", "L", "L", "L",
+        "L", "L", "L", "N", "N", "N", "N", "N", "N", "N", "N", "N", "O", "O", "O", "O",
+        "O", "O", "OE", "OE", "R", "R", "R", "R", "R", "R", "S", "S", "S", "S", "S", "S",
+        "S", "S", "T", "T", "T", "T", "T", "T", "U", "U", "U", "U", "U", "U", "U", "U",
+        "U", "U", "U", "U", "W", "W", "Y", "Y", "Y", "Z", "Z", "Z", "Z", "Z", "Z", "S"
+    };
+}
+
+std::string_view NameIndex::Postings::GetKey(uint32_t index) const
+{
+    return std::string_view(this->keys).substr(this->keyOffsets[index], this->keyLengths[index]);
+}
+
+void NameIndex::Postings::SetKey(uint32_t index, std::string_view key)
+{
+    if (index >= this->keyOffsets.size())
+    {
+        this->keyOffsets.resize((size_t)index + 1, 0);
+        this->keyLengths.resize((size_t)index + 1, 0);
+    }
+
+    this->keyOffsets[index] = (uint32_t)this->keys.size();
+    this->keyLengths[index] = (uint32_t)key.size();
+    this->keys.append(key);
+}
+
+NameIndex::NameIndex() :
+    outdated(true)
+{}
+
+uint32_t NameIndex::GetTrigramKey(std::string_view trigram)
+{
+    return ((uint32_t)(uint8_t)trigram[0] << 16) | ((uint32_t)(uint8_t)trigram[1] << 8) | (uint32_t)(uint8_t)trigram[2];
+}
+
+void NameIndex::AddPostings(Postings& postings, uint32_t index)
+{
+    const std::string_view key = postings.GetKey(index);
+    for (size_t offset = 0; offset + 3 <= key.size(); offset++)
+    {
+        // The same trigram can show up more than once in a name, but the entry is only posted once
+        std::vector<uint32_t>& postingList = postings.trigrams[NameIndex::GetTrigramKey(key.substr(offset, 3))];
+        auto position = std::lower_bound(postingList.begin(), postingList.end(), index);
+
+        if (position == postingList.end() || *position != index)
+            postingList.insert(position, index);
+    }
+}
+
+void NameIndex::RemovePostings(Postings& postings, uint32_t index)
+{
+    const std::string_view key = postings.GetKey(index);
+    for (size_t offset = 0; offset + 3 <= key.size(); offset++)
+    {
+        auto postingList = postings.trigrams.find(NameIndex::GetTrigramKey(key.substr(offset, 3)));
+        if (postingList == postings.trigrams.end())
+            continue;
+
+        auto position = std::lower_bound(postingList->second.begin(), postingList->second.end(), index);
+        if (position != postingList->second.end() && *position == index)
+            postingList->second.erase(position);
+    }
+}
+
+std::vector<uint32_t> NameIndex::Find(const Postings& postings, std::string_view foldedQuery)
+{
+    std::vector<uint32_t> matches;
+
+    // Queries too short to have a trigram are checked against every key, they match most of the database anyway
+    if (foldedQuery.size() < 3)
+    {
+        for (uint32_t index = 0; index < (uint32_t)postings.keyOffsets.size(); index++)
+        {
+            if (postings.GetKey(index).find(foldedQuery) != std::string_view::npos)
+                matches.emplace_back(index);
+        }
+
+        return matches;
+    }
+
+    // Fetch the posting list of every trigram in the query, if any trigram isn't in the index then nothing can match
+    std::vector<const std::vector<uint32_t>*> postingLists;
+    for (size_t offset = 0; offset + 3 <= foldedQuery.size(); offset++)
+    {
+        auto postingList = postings.trigrams.find(NameIndex::GetTrigramKey(foldedQuery.substr(offset, 3)));
+        if (postingList == postings.trigrams.end() || postingList->second.empty())
+            return matches;
+
+        postingLists.emplace_back(&postingList->second);
+    }
+
+    // Intersect the lists from the shortest up, so the work done is bounded by the size of the smallest list
+    std::sort(postingLists.begin(), postingLists.end(),
+        [](const std::vector<uint32_t>* first, const std::vector<uint32_t>* second) { return first->size() < second->size(); });
+
+    std::vector<uint32_t> candidates = *postingLists.front(), intersection;
+    for (size_t list = 1; list < postingLists.size() && !candidates.empty(); list++)
+    {
+        intersection.clear();
+        std::set_intersection(candidates.begin(), candidates.end(), postingLists[list]->begin(), postingLists[list]->end(),
+            std::back_inserter(intersection));
+
+        candidates.swap(intersection);
+    }
+
+    // Having every trigram of the query doesn't mean they're in the right order, so the candidates are checked against the query itself
+    for (uint32_t index : candidates)
+    {
+        if (postings.GetKey(index).find(foldedQuery) != std::string_view::npos)
+            matches.emplace_back(index);
+    }
+
+    return matches;
+}
+
+std::vector<NameIndex::ApproximateMatch> NameIndex::FindApproximate(const Postings& postings, std::string_view foldedQuery, int maxDistance)
+{
+    std::vector<ApproximateMatch> matches;
+
+    const std::string_view query = foldedQuery.substr(0, NameIndex::maxApproximateQueryLength);
+    if (query.empty())
+        return matches;
+
+    // Mark the positions in the query where each byte appears
+    std::array<uint64_t, 256> positionMasks = {};
+    for (size_t position = 0; position < query.size(); position++)
+        positionMasks[(uint8_t)query[position]] |= (1ull << position);
+
+    const uint64_t lastRowBit = 1ull << (query.size() - 1);
+    const uint64_t queryMask = (query.size() == 64) ? ~0ull : ((1ull << query.size()) - 1);
+
+    for (uint32_t index = 0; index < (uint32_t)postings.keyOffsets.size(); index++)
+    {
+        // The vertical differences between adjacent rows of the edit distance matrix are kept as bit vectors, and the score is the distance
+        // of the whole query ending at the current byte of the key. The match can start anywhere in the key, so the top row stays at 0.
+        uint64_t positiveVertical = queryMask, negativeVertical = 0;
+        int score = (int)query.size(), bestScore = score;
+
+        for (const char character : postings.GetKey(index))
+        {
+            const uint64_t equal = positionMasks[(uint8_t)character];
+            const uint64_t verticalCandidates = equal | negativeVertical;
+            const uint64_t horizontalCandidates = (((equal & positiveVertical) + positiveVertical) ^ positiveVertical) | equal;
+
+            uint64_t positiveHorizontal = negativeVertical | ~(horizontalCandidates | positiveVertical);
+            uint64_t negativeHorizontal = positiveVertical & horizontalCandidates;
+
+            if (positiveHorizontal & lastRowBit)
+                ++score;
+            else if (negativeHorizontal & lastRowBit)
+                --score;
+
+            positiveHorizontal <<= 1;
+            negativeHorizontal <<= 1;
+
+            positiveVertical = (negativeHorizontal | ~(verticalCandidates | positiveHorizontal)) & queryMask;
+            negativeVertical = positiveHorizontal & verticalCandidates & queryMask;
+
+            bestScore = std::min(bestScore, score);
+        }
+
+        if (bestScore <= maxDistance)
+            matches.push_back({ index, bestScore });
+    }
+
+    std::stable_sort(matches.begin(), matches.end(), [](const ApproximateMatch& first, const ApproximateMatch& second)
+        {
+            return first.distance < second.distance;
+        });
+
+    return matches;
+}
+
+void NameIndex::Update()
+{
+    if (this->outdated)
+        this->Rebuild();
+}
+
+void NameIndex::Invalidate()
+{
+    this->outdated = true;
+}
+
+void NameIndex::Rebuild()
+{
+    const std::vector<Player>& playerDatabase = SaveData::GetInstance().GetPlayerDatabase();
+    const std::vector<Club>& clubDatabase = SaveData::GetInstance().GetClubDatabase();
+
+    // The names are only folded here (and when a player is renamed), so searches never have to fold the names themselves
+    this->players = Postings();
+    for (uint32_t index = 0; index < (uint32_t)playerDatabase.size(); index++)
+    {
+        // Retired players are only kept for the transfer history, so they're given an empty key which no search can match
+        if (playerDatabase[index].IsRetired())
+        {
+            this->players.SetKey(index, std::string_view());
+            continue;
+        }
+
+        this->players.SetKey(index, NameIndex::FoldName(playerDatabase[index].GetName()));
+        NameIndex::AddPostings(this->players, index);
+    }
+
+    this->clubs = Postings();
+    for (uint32_t index = 0; index < (uint32_t)clubDatabase.size(); index++)
+    {
+        this->clubs.SetKey(index, NameIndex::FoldName(clubDatabase[index].GetName()));
+        NameIndex::AddPostings(this->clubs, index);
+    }
+
+    this->outdated = false;
+}
+
+void NameIndex::RefreshPlayer(const Player& player)
+{
+    if (this->outdated)
+        return;
+
+    const std::vector<Player>& playerDatabase = SaveData::GetInstance().GetPlayerDatabase();
+    const uint32_t index = (uint32_t)(&player - playerDatabase.data());
+
+    if (index >= this->players.keyOffsets.size())
+    {
+        this->Invalidate();
+        return;
+    }
+
+    NameIndex::RemovePostings(this->players, index);
+    this->players.SetKey(index, NameIndex::FoldName(player.GetName()));
+    NameIndex::AddPostings(this->players, index);
+}
+
+std::vector<uint32_t> NameIndex::FindPlayers(std::string_view query)
+{
+    this->Update();
+    return NameIndex::Find(this->players, NameIndex::FoldName(query));
+}
+
+std::vector<uint32_t> NameIndex::FindClubs(std::string_view query)
+{
+    this->Update();
+    return NameIndex::Find(this->clubs, NameIndex::FoldName(query));
+}
+
+std::vector<NameIndex::ApproximateMatch> NameIndex::FindPlayersApproximate(std::string_view query, int maxDistance)
+{
+    this->Update();
+    return NameIndex::FindApproximate(this->players, NameIndex::FoldName(query), maxDistance);
+}
+
+std::vector<NameIndex::ApproximateMatch> NameIndex::FindClubsApproximate(std::string_view query, int maxDistance)
+{
+    this->Update();
+    return NameIndex::FindApproximate(this->clubs, NameIndex::FoldName(query), maxDistance);
+}
+
+bool NameIndex::PlayerNameContains(uint32_t playerIndex, const std::string& foldedQuery)
+{
+    this->Update();
+    return playerIndex < this->players.keyOffsets.size() && this->players.GetKey(playerIndex).find(foldedQuery) != std::string_view::npos;
+}
+
+bool NameIndex::ClubNameContains(uint32_t clubIndex, const std::string& foldedQuery)
+{
+    this->Update();
+    return clubIndex < this->clubs.keyOffsets.size() && this->clubs.GetKey(clubIndex).find(foldedQuery) != std::string_view::npos;
+}
+
+std::string NameIndex::FoldName(std::string_view name)
+{
+    std::string foldedName;
+    foldedName.reserve(name.size());
+
+    for (size_t index = 0; index < name.size(); index++)
+    {
+        const uint8_t character = (uint8_t)name[index];
+        if (character < 0x80)
+        {
+            foldedName.push_back((char)std::toupper(character));
+            continue;
+        }
+
+        // Every accented Latin letter in the table is encoded as two bytes in UTF-8, anything else is kept as it is
+        if ((character & 0xE0) == 0xC0 && index + 1 < name.size() && ((uint8_t)name[index + 1] & 0xC0) == 0x80)
+        {
+            const uint32_t codePoint = ((uint32_t)(character & 0x1F) << 6) | (uint32_t)((uint8_t)name[index + 1] & 0x3F);
+            if (codePoint >= firstFoldedCodePoint && codePoint - firstFoldedCodePoint < foldedLatinLetters.size() &&
+                !foldedLatinLetters[codePoint - firstFoldedCodePoint].empty())
+            {
+                foldedName.append(foldedLatinLetters[codePoint - firstFoldedCodePoint]);
+                ++index;
+                continue;
+            }
+        }
+
+        foldedName.push_back((char)character);
+    }
+
+    return foldedName;
+}
@@ -0,0 +1,103 @@
+#ifndef NAME_INDEX_H
+#define NAME_INDEX_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <unordered_map>
+
+class Player;
+
+class NameIndex
+{
+public:
+	struct ApproximateMatch
+	{
+		uint32_t index; // The database index of the entry
+		int distance; // The fewest edits (insertions, deletions or substitutions) needed to find the query in the entry's search key
+	};
+
+	// The longest query which can be matched approximately, as the query's bits have to fit in a machine word
+	static constexpr size_t maxApproximateQueryLength = 64;
+private:
+	// The search keys of a database's names, along with the entries containing each trigram (three byte sequence) of the keys.
+	// The keys are packed one after another into a single buffer, and the posting lists are kept sorted so they can be intersected in a
+	// single pass.
+	struct Postings
+	{
+		std::string keys;
+		std::vector<uint32_t> keyOffsets, keyLengths; // Indexed by database index
+
+		std::unordered_map<uint32_t, std::vector<uint32_t>> trigrams;
+
+		// Returns the search key of the entry at the database index given.
+		std::string_view GetKey(uint32_t index) const;
+
+		// Sets the search key of the entry at the database index given. The key is added onto the end of the buffer, so the space taken up
+		// by a replaced key is only freed once the index is rebuilt.
+		void SetKey(uint32_t index, std::string_view key);
+	};
+
+	Postings players, clubs;
+	bool outdated;
+private:
+	// Returns the key of the trigram starting at the first character of the string given.
+	static uint32_t GetTrigramKey(std::string_view trigram);
+
+	// Adds the entry at the database index given into the postings of each trigram of its search key.
+	static void AddPostings(Postings& postings, uint32_t index);
+
+	// Removes the entry at the database index given from the postings of each trigram of its search key.
+	static void RemovePostings(Postings& postings, uint32_t index);
+
+	// Returns the database indices, in ascending order, of the entries whose search key contains the folded query given.
+	static std::vector<uint32_t> Find(const Postings& postings, std::string_view foldedQuery);
+
+	// Returns the entries whose search key contains the folded query given with no more than the number of edits given, ordered by
+	// edit distance then database index. Every key is scanned with Myers' bit-parallel algorithm, which steps through a key a whole
+	// byte at a time regardless of the query's length, so scanning every name in the database only takes a fraction of a millisecond.
+	static std::vector<ApproximateMatch> FindApproximate(const Postings& postings, std::string_view foldedQuery, int maxDistance);
+
+	// Rebuilds the index if it has been flagged as outdated.
+	void Update();
+public:
+	NameIndex();
+	~NameIndex() = default;
+
+	// Flags the index as outdated, so it is rebuilt the next time it is queried.
+	// This must be called whenever the player or club databases are reloaded.
+	void Invalidate();
+
+	// Rebuilds the index from the save's player and club databases.
+	void Rebuild();
+
+	// Updates the indexed name of the player given, this should be called whenever a player's name changes.
+	// Transfers don't need to update the index, as players are matched to clubs through the club's current squad.
+	void RefreshPlayer(const Player& player);
+
+	// Returns the player database indices, in ascending order, of the players whose name contains the query given (ignoring case and accents).
+	std::vector<uint32_t> FindPlayers(std::string_view query);
+
+	// Returns the club database indices, in ascending order, of the clubs whose name contains the query given (ignoring case and accents).
+	std::vector<uint32_t> FindClubs(std::string_view query);
+
+	// Returns the players whose name contains the query given with no more than the number of edits given, closest matches first.
+	// Queries longer than the max approximate query length are cut short.
+	std::vector<ApproximateMatch> FindPlayersApproximate(std::string_view query, int maxDistance);
+
+	// Returns the clubs whose name contains the query given with no more than the number of edits given, closest matches first.
+	// Queries longer than the max approximate query length are cut short.
+	std::vector<ApproximateMatch> FindClubsApproximate(std::string_view query, int maxDistance);
+
+	// Returns TRUE if the name of the player at the player database index given contains the folded query given.
+	bool PlayerNameContains(uint32_t playerIndex, const std::string& foldedQuery);
+
+	// Returns TRUE if the name of the club at the club database index given contains the folded query given.
+	bool ClubNameContains(uint32_t clubIndex, const std::string& foldedQuery);
+
+	// Returns the search key of the UTF-8 name given, which is the name in upper case with the accents stripped off its Latin letters.
+	static std::string FoldName(std::string_view name);
+};
+
+#endif
@@ -156,4 +156,9 @@ bool Player::GetTransferListed() const
 bool Player::GetTransfersBlocked() const
 {
     return this->transfersBlocked;
-}
\ No newline at end of file
+}
+
+bool Player::IsRetired() const
+{
+    return this->clubID == Player::retiredClubID;
+}
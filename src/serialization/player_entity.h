@@ -1,10 +1,14 @@
 #ifndef PLAYER_ENTITY_H
 #define PLAYER_ENTITY_H
 
+#include <cstdint>
 #include <string>
 
 class Player
 {
+public:
+	// The club ID of retired players, who are kept in the database so the transfer history can still refer to them
+	static constexpr uint16_t retiredClubID = UINT16_MAX;
 private:
 	std::string name, nation, preferredFoot;
 	uint16_t id, clubID, positionID;
@@ -104,6 +108,9 @@ public:
 
 	// Returns TRUE if all transfers for the player is blocked.
 	bool GetTransfersBlocked() const;
+
+	// Returns TRUE if the player has retired from football.
+	bool IsRetired() const;
 };
 
 #endif
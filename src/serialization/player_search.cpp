@@ -0,0 +1,284 @@
+#include <serialization/player_search.h>
+#include <serialization/save_data.h>
+#include <simulation/scouting_engine.h>
+
+#include <algorithm>
+
+namespace
+{
+    // The number of players recommended by a scouting query
+    constexpr size_t totalScoutingRecommendations = 100;
+
+    // The number of players looked at between checks of whether the search has been cancelled
+    constexpr size_t cancellationCheckInterval = 1024;
+
+    // Returns the number of typos allowed in a name filter of the length given, once it hasn't matched any names exactly.
+    // Short filters are left alone, as almost any name is within a typo or two of them.
+    inline int GetAllowedTypos(size_t filterLength)
+    {
+        if (filterLength < 4)
+            return 0;
+
+        return (filterLength < 8) ? 1 : 2;
+    }
+
+    // Returns the value of the number filter given, or the fallback given if it's empty.
+    // The number filters are capped at 3 digits as no age or potential goes above that.
+    inline int GetNumberFilter(const std::string& text, int fallback)
+    {
+        return text.empty() ? fallback : std::stoi(text.substr(0, 3));
+    }
+}
+
+bool PlayerSearch::Query::IsEmpty() const
+{
+    return this->playerName.empty() && this->clubName.empty() && this->position.empty() && this->maxAge.empty() && this->minPotential.empty() &&
+        this->filters.empty() && !this->affordableOnly;
+}
+
+bool PlayerSearch::Query::operator==(const Query& other) const
+{
+    return this->playerName == other.playerName && this->clubName == other.clubName && this->position == other.position &&
+        this->maxAge == other.maxAge && this->minPotential == other.minPotential && this->filters == other.filters &&
+        this->affordableOnly == other.affordableOnly && this->clubID == other.clubID && this->transferBudget == other.transferBudget &&
+        this->wageBudget == other.wageBudget;
+}
+
+bool PlayerSearch::Query::operator!=(const Query& other) const
+{
+    return !(*this == other);
+}
+
+int PlayerSearch::GetExactPosition(const Query& query)
+{
+    for (const SaveData::Position& position : SaveData::GetInstance().GetPositionDatabase())
+    {
+        if (position.type == query.position)
+            return position.id;
+    }
+
+    return -1;
+}
+
+bool PlayerSearch::IsScoutingQuery(const Query& query)
+{
+    // Without any name filters, the players who best fit the rest of the filters are recommended. The position filter has to name a
+    // position exactly for it to be used by the scouting engine.
+    const int positionID = PlayerSearch::GetExactPosition(query);
+    const bool scoutingFiltersEmpty = query.maxAge.empty() && query.minPotential.empty() && query.filters.empty() && !query.affordableOnly;
+
+    return query.playerName.empty() && query.clubName.empty() && (query.position.empty() || positionID != -1) &&
+        (!scoutingFiltersEmpty || positionID != -1);
+}
+
+void PlayerSearch::AddNumberFilters(const Query& query, PlayerFilter& filter)
+{
+    if (!query.maxAge.empty())
+        filter.AddCondition(PlayerFilter::Field::AGE, INT_MIN, GetNumberFilter(query.maxAge, INT_MAX));
+
+    if (!query.minPotential.empty())
+        filter.AddCondition(PlayerFilter::Field::POTENTIAL, GetNumberFilter(query.minPotential, INT_MIN), INT_MAX);
+
+    if (query.affordableOnly)
+    {
+        filter.AddCondition(PlayerFilter::Field::VALUE, INT_MIN, query.transferBudget);
+        filter.AddCondition(PlayerFilter::Field::WAGE, INT_MIN, query.wageBudget);
+    }
+}
+
+void PlayerSearch::Recommend(const Query& query, const ScoutingEngine::CompiledFilter& filter, Results& results)
+{
+    // The number filters are already part of the compiled filter, so the profile only has to pick out the position and the searching club
+    ScoutingEngine::Profile profile;
+    profile.positionID = PlayerSearch::GetExactPosition(query);
+    profile.excludedClubID = query.clubID;
+    profile.filter = &filter;
+
+    const Player* firstPlayer = SaveData::GetInstance().GetPlayerDatabase().data();
+
+    results.playerIndices.clear();
+    results.refinable = false;
+
+    for (const ScoutingEngine::Recommendation& recommendation : ScoutingEngine::GetInstance().Recommend(profile, totalScoutingRecommendations))
+        results.playerIndices.emplace_back((uint32_t)(recommendation.player - firstPlayer));
+}
+
+bool PlayerSearch::Find(const Query& query, const ScoutingEngine::CompiledFilter& filter, const BackgroundWorker::CancellationToken& cancelled,
+    Results& results)
+{
+    const std::vector<Player>& playerDatabase = SaveData::GetInstance().GetPlayerDatabase();
+
+    // Look up the candidate players through the name index, so only the players with a matching name or club are looked at
+    std::vector<uint32_t>& candidates = results.playerIndices;
+    candidates.clear();
+    std::vector<uint16_t> matchingClubIDs, orderedClubIDs; // The matching clubs sorted by ID, and in the order the name index matched them
+
+    NameIndex& nameIndex = SaveData::GetInstance().GetNameIndex();
+    bool matchedApproximately = false;
+
+    if (!query.clubName.empty())
+    {
+        // If no club name contains the filter, then it most likely has a typo in it, so the closest club names are used instead
+        std::vector<uint32_t> clubIndices = nameIndex.FindClubs(query.clubName);
+        if (clubIndices.empty())
+        {
+            for (const NameIndex::ApproximateMatch& match : nameIndex.FindClubsApproximate(query.clubName, GetAllowedTypos(query.clubName.size())))
+                clubIndices.emplace_back(match.index);
+
+            matchedApproximately = true;
+        }
+
+        for (uint32_t clubIndex : clubIndices)
+        {
+            const Club& club = SaveData::GetInstance().GetClubDatabase()[clubIndex];
+            if (club.GetID() != query.clubID)
+                orderedClubIDs.emplace_back(club.GetID());
+        }
+
+        matchingClubIDs = orderedClubIDs;
+        std::sort(matchingClubIDs.begin(), matchingClubIDs.end());
+    }
+
+    if (!query.playerName.empty())
+    {
+        candidates = nameIndex.FindPlayers(query.playerName);
+
+        // The same goes for the player name filter, with the closest matches listed first
+        if (candidates.empty())
+        {
+            for (const NameIndex::ApproximateMatch& match : nameIndex.FindPlayersApproximate(query.playerName, GetAllowedTypos(query.playerName.size())))
+                candidates.emplace_back(match.index);
+
+            matchedApproximately = true;
+        }
+    }
+    else if (!query.clubName.empty())
+    {
+        // The clubs' current squads are used rather than indexing each player's club name, so transfers don't have to touch the index
+        for (uint16_t clubID : orderedClubIDs)
+        {
+            for (const Player* player : SaveData::GetInstance().GetClub(clubID)->GetPlayers())
+                candidates.emplace_back((uint32_t)(player - playerDatabase.data()));
+        }
+
+        // Approximate matches keep the players of the closest clubs first, otherwise the players are listed in database order
+        if (!matchedApproximately)
+            std::sort(candidates.begin(), candidates.end());
+    }
+    else if (filter.positionID >= 0)
+    {
+        // The structured filters pin down the position, so only that position's players are looked at
+        candidates = ScoutingEngine::GetInstance().GetPlayersInPosition((uint16_t)filter.positionID);
+    }
+    else
+    {
+        candidates.resize(playerDatabase.size());
+        for (uint32_t playerIndex = 0; playerIndex < (uint32_t)candidates.size(); playerIndex++)
+            candidates[playerIndex] = playerIndex;
+    }
+
+    // Keep the candidates which match the rest of the filters and aren't already in the searching club
+    size_t totalKept = 0;
+    for (size_t index = 0; index < candidates.size(); index++)
+    {
+        if (index % cancellationCheckInterval == 0 && cancelled)
+            return false;
+
+        const Player& player = playerDatabase[candidates[index]];
+        const SaveData::Position& position = *SaveData::GetInstance().GetPosition(player.GetPosition());
+
+        if (!player.IsRetired() && (query.clubName.empty() || std::binary_search(matchingClubIDs.begin(), matchingClubIDs.end(), player.GetClub())) &&
+            (query.position.empty() || position.type.find(query.position) != std::string::npos) && player.GetClub() != query.clubID &&
+            filter.Matches(candidates[index]))
+        {
+            candidates[totalKept++] = candidates[index];
+        }
+    }
+
+    candidates.resize(totalKept);
+
+    // Approximate matches aren't guaranteed to contain a longer filter's text, so they can't be refined
+    results.refinable = !matchedApproximately;
+
+    return true;
+}
+
+bool PlayerSearch::Refine(const Query& query, const ScoutingEngine::CompiledFilter& filter, const BackgroundWorker::CancellationToken& cancelled,
+    Results& results)
+{
+    const std::vector<Player>& playerDatabase = SaveData::GetInstance().GetPlayerDatabase();
+    const std::vector<Club>& clubDatabase = SaveData::GetInstance().GetClubDatabase();
+    NameIndex& nameIndex = SaveData::GetInstance().GetNameIndex();
+
+    std::vector<uint32_t>& candidates = results.playerIndices;
+    size_t totalKept = 0;
+
+    for (size_t index = 0; index < candidates.size(); index++)
+    {
+        if (index % cancellationCheckInterval == 0 && cancelled)
+            return false;
+
+        const uint32_t playerIndex = candidates[index];
+        const Player& player = playerDatabase[playerIndex];
+
+        if ((query.playerName.empty() || nameIndex.PlayerNameContains(playerIndex, query.playerName)) &&
+            (query.clubName.empty() || nameIndex.ClubNameContains((uint32_t)(SaveData::GetInstance().GetClub(player.GetClub()) - clubDatabase.data()),
+                query.clubName)) &&
+            (query.position.empty() || SaveData::GetInstance().GetPosition(player.GetPosition())->type.find(query.position) != std::string::npos) &&
+            filter.Matches(playerIndex))
+        {
+            candidates[totalKept++] = playerIndex;
+        }
+    }
+
+    candidates.resize(totalKept);
+    return true;
+}
+
+bool PlayerSearch::Refines(const Query& query, const Query& previousQuery, const Results& previousResults)
+{
+    // Adding characters to a filter can only narrow down its matches, so the previous results can be filtered in that case. Editing the
+    // structured filters can widen their matches though, so they can only be refined if they're unchanged or newly added. The number
+    // filters can be refined as long as they're unchanged or tightened.
+    return previousResults.refinable && !PlayerSearch::IsScoutingQuery(query) && query.clubID == previousQuery.clubID &&
+        query.playerName.find(previousQuery.playerName) != std::string::npos && query.clubName.find(previousQuery.clubName) != std::string::npos &&
+        query.position.find(previousQuery.position) != std::string::npos && (previousQuery.filters.empty() || query.filters == previousQuery.filters) &&
+        GetNumberFilter(query.maxAge, INT_MAX) <= GetNumberFilter(previousQuery.maxAge, INT_MAX) &&
+        GetNumberFilter(query.minPotential, INT_MIN) >= GetNumberFilter(previousQuery.minPotential, INT_MIN) &&
+        (!previousQuery.affordableOnly || (query.affordableOnly && query.transferBudget <= previousQuery.transferBudget &&
+            query.wageBudget <= previousQuery.wageBudget));
+}
+
+bool PlayerSearch::Run(const Query& query, const Query& previousQuery, Results& results, const BackgroundWorker::CancellationToken& cancelled)
+{
+    PlayerFilter playerFilter;
+    if (query.IsEmpty() || !playerFilter.Parse(query.filters))
+    {
+        results.playerIndices.clear();
+        results.refinable = false;
+        return true;
+    }
+
+    PlayerSearch::AddNumberFilters(query, playerFilter);
+
+    // The filter is compiled once for the whole search, with its tests ordered by how selective they are
+    const ScoutingEngine::CompiledFilter filter = ScoutingEngine::GetInstance().CompileFilter(playerFilter);
+
+    if (PlayerSearch::IsScoutingQuery(query))
+    {
+        PlayerSearch::Recommend(query, filter, results);
+        return !cancelled;
+    }
+
+    // If refining leaves nothing, then the latest edit most likely added a typo, so a full search is run to fall back on approximate matches
+    if (PlayerSearch::Refines(query, previousQuery, results))
+    {
+        if (!PlayerSearch::Refine(query, filter, cancelled, results))
+            return false;
+
+        if (!results.playerIndices.empty())
+            return true;
+    }
+
+    return PlayerSearch::Find(query, filter, cancelled, results);
+}
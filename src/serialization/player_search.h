@@ -0,0 +1,73 @@
+#ifndef PLAYER_SEARCH_H
+#define PLAYER_SEARCH_H
+
+#include <simulation/scouting_engine.h>
+#include <util/background_worker.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class PlayerSearch
+{
+public:
+	// The filters of a search, the name filters are folded in the form the names are compared in
+	struct Query
+	{
+		std::string playerName, clubName, position, maxAge, minPotential;
+		std::string filters; // The structured filters, parsed by the player filter
+		bool affordableOnly = false;
+
+		// The club doing the search, whose players are left out of the results, and the budgets it can afford players with
+		uint16_t clubID = 0;
+		int transferBudget = 0, wageBudget = 0;
+
+		// Returns TRUE if none of the filters have been entered.
+		bool IsEmpty() const;
+
+		// Returns TRUE if the queries have the same filters.
+		bool operator==(const Query& other) const;
+		bool operator!=(const Query& other) const;
+	};
+
+	struct Results
+	{
+		std::vector<uint32_t> playerIndices; // Indices into the save's player database
+		bool refinable = false; // Set as TRUE if the results came from an exact name, club and position search, which a longer query can refine
+	};
+private:
+	// Returns the ID of the position the query's position filter names exactly, or -1 if it doesn't name a position.
+	static int GetExactPosition(const Query& query);
+
+	// Returns TRUE if the query is a scouting query, which recommends the players who best fit the filters rather than matching names.
+	static bool IsScoutingQuery(const Query& query);
+
+	// Adds the query's max age, min potential and affordability filters to the player filter given, so every kind of search applies them.
+	static void AddNumberFilters(const Query& query, PlayerFilter& filter);
+
+	// Fills the results given with the players who best fit the query's filters, ordered from the best fit down.
+	static void Recommend(const Query& query, const ScoutingEngine::CompiledFilter& filter, Results& results);
+
+	// Fills the results given with the players whose name, club and position match the query's filters, looked up through the name index.
+	// A name filter which no name contains is matched approximately instead, with the closest names first.
+	// Returns FALSE if the search was cancelled before it finished.
+	static bool Find(const Query& query, const ScoutingEngine::CompiledFilter& filter, const BackgroundWorker::CancellationToken& cancelled,
+		Results& results);
+
+	// Removes the players which don't match the query's filters from the results given.
+	// Returns FALSE if the search was cancelled before it finished.
+	static bool Refine(const Query& query, const ScoutingEngine::CompiledFilter& filter, const BackgroundWorker::CancellationToken& cancelled,
+		Results& results);
+public:
+	PlayerSearch() = delete;
+
+	// Returns TRUE if every result of the query given is also a result of the previous query given, with the previous results given.
+	static bool Refines(const Query& query, const Query& previousQuery, const Results& previousResults);
+
+	// Runs the query given and fills in its results. If the previous results given can be refined by the query, then they're filtered
+	// down rather than searching the whole database again. Returns FALSE if the search was cancelled before it finished.
+	// Queries with structured filters which can't be parsed have no results.
+	// This only reads from the save's database, so it can be run off the main thread as long as the database isn't changed meanwhile.
+	static bool Run(const Query& query, const Query& previousQuery, Results& results, const BackgroundWorker::CancellationToken& cancelled);
+};
+
+#endif
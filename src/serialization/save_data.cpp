@@ -2,6 +2,10 @@
 #include <serialization/json_loader.h>
 #include <util/directory_system.h>
 #include <util/logging_system.h>
+#include <util/random_engine.h>
+
+#include <array>
+#include <utility>
 
 SaveData::SaveData() :
     playerCount(0), growthSystemType(GrowthSystemType::SKILL_POINTS), currentYear(0), currentLeague(nullptr)
@@ -32,6 +36,31 @@ void SaveData::SetCurrentLeague(League* league)
     this->currentLeague = league;
 }
 
+void SaveData::AddPlayers(const std::vector<Player>& players)
+{
+    if (players.empty())
+        return;
+
+    // Note down the database index of every club's players, since the pointers are left dangling if the database is reallocated
+    std::vector<std::vector<size_t>> squadIndices(this->clubDatabase.size());
+    for (size_t clubIndex = 0; clubIndex < this->clubDatabase.size(); clubIndex++)
+    {
+        for (const Player* player : this->clubDatabase[clubIndex].GetPlayers())
+            squadIndices[clubIndex].emplace_back(player - this->playerDatabase.data());
+    }
+
+    this->playerDatabase.insert(this->playerDatabase.end(), players.begin(), players.end());
+
+    for (size_t clubIndex = 0; clubIndex < this->clubDatabase.size(); clubIndex++)
+    {
+        std::vector<Player*>& squad = this->clubDatabase[clubIndex].GetPlayers();
+        for (size_t index = 0; index < squad.size(); index++)
+            squad[index] = &this->playerDatabase[squadIndices[clubIndex][index]];
+    }
+
+    this->nameIndex.Invalidate();
+}
+
 void SaveData::LoadCupsFromJSON(const nlohmann::json& dataRoot)
 {
     uint16_t id = 1000;
@@ -56,6 +85,34 @@ void SaveData::LoadCupsFromJSON(const nlohmann::json& dataRoot)
     this->cupDatabase.shrink_to_fit();
 }
 
+void SaveData::LoadCupBracketsFromJSON(const nlohmann::json& dataRoot)
+{
+    for (KnockoutCup& cup : this->cupDatabase)
+    {
+        cup.GetBracket().Reset({});
+
+        // Saves made before cups were simulated don't have any brackets, their cups are drawn the next time the season is advanced
+        const std::string idStr = std::to_string(cup.GetID());
+        if (!dataRoot.contains("cupBrackets") || !dataRoot["cupBrackets"].contains(idStr))
+            continue;
+
+        const nlohmann::json& bracketRoot = dataRoot["cupBrackets"][idStr];
+        cup.GetBracket().Reset(bracketRoot["entrants"].get<std::vector<uint16_t>>());
+
+        // Each round is stored as a flat list of the home club ID, away club ID and whether the home club won, for every tie
+        for (const nlohmann::json& roundRoot : bracketRoot["rounds"])
+        {
+            const std::vector<int> values = roundRoot.get<std::vector<int>>();
+
+            std::vector<CupBracket::Tie> ties;
+            for (size_t index = 0; index + 2 < values.size(); index += 3)
+                ties.push_back({ (uint16_t)values[index], (uint16_t)values[index + 1], values[index + 2] != 0 });
+
+            cup.GetBracket().AddRound(ties);
+        }
+    }
+}
+
 void SaveData::LoadLeaguesFromJSON(const nlohmann::json& dataRoot)
 {
     uint16_t id = 0;
@@ -95,6 +152,40 @@ void SaveData::LoadLeaguesFromJSON(const nlohmann::json& dataRoot)
     }
 
     this->leagueDatabase.shrink_to_fit();
+    this->competitionRankIndex.Invalidate();
+}
+
+void SaveData::LoadLeagueTablesFromJSON(const nlohmann::json& dataRoot)
+{
+    // Saves made before league tables were simulated don't have any, their tables are caught up the next time the season is advanced
+    if (!dataRoot.contains("leagueTables"))
+        return;
+
+    for (League& league : this->leagueDatabase)
+    {
+        const std::string idStr = std::to_string(league.GetID());
+        if (!dataRoot["leagueTables"].contains(idStr))
+            continue;
+
+        const nlohmann::json& tableRoot = dataRoot["leagueTables"][idStr];
+
+        // Fetch the standing of every club in the league table
+        LeagueTable& table = league.GetTable();
+        for (const nlohmann::json& standingRoot : tableRoot["standings"])
+        {
+            LeagueTable::Standing standing;
+            standing.clubID = standingRoot["clubID"].get<uint16_t>();
+            standing.wins = standingRoot["wins"].get<int>();
+            standing.draws = standingRoot["draws"].get<int>();
+            standing.losses = standingRoot["losses"].get<int>();
+            standing.scored = standingRoot["scored"].get<int>();
+            standing.conceded = standingRoot["conceded"].get<int>();
+
+            table.SetStanding(standing);
+        }
+
+        table.SetRoundsPlayed(tableRoot["roundsPlayed"].get<int>());
+    }
 }
 
 void SaveData::LoadUsersFromJSON(const nlohmann::json& dataRoot)
@@ -154,6 +245,7 @@ void SaveData::LoadUsersFromJSON(const nlohmann::json& dataRoot)
     }
 
     this->users.shrink_to_fit();
+    this->clubIndex.Invalidate();
 }
 
 void SaveData::LoadClubsFromJSON(const nlohmann::json& dataRoot, bool loadingDefault)
@@ -247,6 +339,9 @@ void SaveData::LoadClubsFromJSON(const nlohmann::json& dataRoot, bool loadingDef
     }
 
     this->clubDatabase.shrink_to_fit();
+    this->clubIndex.Invalidate();
+    this->competitionRankIndex.Invalidate();
+    this->nameIndex.Invalidate();
 }
 
 void SaveData::LoadPlayersFromJSON(const nlohmann::json& dataRoot, bool loadingDefault)
@@ -292,10 +387,17 @@ void SaveData::LoadPlayersFromJSON(const nlohmann::json& dataRoot, bool loadingD
     }
 
     this->playerDatabase.shrink_to_fit();
+    this->nameIndex.Invalidate();
 }
 
 void SaveData::LoadPositionsFromJSON(const nlohmann::json& dataRoot)
 {
+    // The pairs of positions which players can switch between without being out of position
+    constexpr std::array<std::pair<std::string_view, std::string_view>, 14> compatiblePositionTypes = {{
+        { "LB", "RB" }, { "LB", "CB" }, { "RB", "CB" }, { "CB", "CDM" }, { "CDM", "CM" }, { "CM", "CAM" }, { "CAM", "ST" },
+        { "LM", "LW" }, { "RM", "RW" }, { "LM", "RM" }, { "LW", "RW" }, { "LW", "ST" }, { "RW", "ST" }, { "CM", "LM" }
+    }};
+
     uint16_t id = 0;
     while (dataRoot.contains(std::to_string(id)))
     {
@@ -308,10 +410,48 @@ void SaveData::LoadPositionsFromJSON(const nlohmann::json& dataRoot)
         // Add the position to the database
         this->positionDatabase.push_back({ id, positionType, category });
 
+        // Work out the position's traits, attacking minded players are forwards and every midfielder other than defensive midfielders
+        PositionTraits traits;
+        traits.category = category;
+        traits.staffType = (Club::StaffType)category;
+        traits.goalkeeper = (category == PositionCategory::GOALKEEPER);
+        traits.attackingMinded = (category == PositionCategory::FORWARD) || 
+            (category == PositionCategory::MIDFIELDER && positionType.find("DM") == std::string::npos);
+
+        if (id < 32)
+            traits.compatiblePositions = (1u << id);
+        else
+            LogSystem::GetInstance().OutputLog("Only the first 32 positions can be compatible with other positions (Position ID: " + idStr + ")", 
+                Severity::WARNING);
+
+        this->positionTraits.push_back(traits);
+
         ++id;
     }
 
+    // Now every position is loaded, mark the positions which are compatible with each other
+    for (const auto& [firstType, secondType] : compatiblePositionTypes)
+    {
+        const Position* first = nullptr;
+        const Position* second = nullptr;
+
+        for (const Position& position : this->positionDatabase)
+        {
+            if (position.type == firstType)
+                first = &position;
+            else if (position.type == secondType)
+                second = &position;
+        }
+
+        if (first && second && first->id < 32 && second->id < 32)
+        {
+            this->positionTraits[first->id].compatiblePositions |= (1u << second->id);
+            this->positionTraits[second->id].compatiblePositions |= (1u << first->id);
+        }
+    }
+
     this->positionDatabase.shrink_to_fit();
+    this->positionTraits.shrink_to_fit();
 }
 
 void SaveData::LoadMiscellaneousFromJSON(const nlohmann::json& dataRoot)
@@ -365,6 +505,9 @@ void SaveData::Write(float& currentProgress, std::mutex& mutex)
     file.GetRoot()["currentYear"] = this->currentYear;
     file.GetRoot()["currentLeagueID"] = this->currentLeague->GetID();
 
+    // Write the seed used by the save's random streams, so simulations can be replayed when the save is loaded again
+    file.GetRoot()["randomSeed"] = RandomEngine::GetInstance().GetSeed();
+
     // Write the data of all clubs into the JSON structure
     for (const Club& club : this->clubDatabase)
     {
@@ -427,6 +570,14 @@ void SaveData::Write(float& currentProgress, std::mutex& mutex)
         }
     }
 
+    // Write the standings of every league table into the JSON structure
+    for (const League& league : this->leagueDatabase)
+        this->ConvertLeagueTableToJSON(file.GetRoot(), league);
+
+    // Write the bracket of every cup competition into the JSON structure
+    for (const KnockoutCup& cup : this->cupDatabase)
+        this->ConvertCupBracketToJSON(file.GetRoot(), cup);
+
     file.Close();
     file.Clear();
 
@@ -589,6 +740,53 @@ const uint16_t& SaveData::GetCurrentYear() const
     return this->currentYear;
 }
 
+void SaveData::ConvertLeagueTableToJSON(nlohmann::json& root, const League& league) const
+{
+    const LeagueTable& table = league.GetTable();
+    if (table.GetRoundsPlayed() == 0)
+        return;
+
+    const std::string idStr = std::to_string(league.GetID());
+    root["leagueTables"][idStr]["roundsPlayed"] = table.GetRoundsPlayed();
+
+    for (size_t index = 0; index < table.GetStandings().size(); index++)
+    {
+        const LeagueTable::Standing& standing = table.GetStandings()[index];
+        root["leagueTables"][idStr]["standings"][std::to_string(index + 1)]["clubID"] = standing.clubID;
+        root["leagueTables"][idStr]["standings"][std::to_string(index + 1)]["wins"] = standing.wins;
+        root["leagueTables"][idStr]["standings"][std::to_string(index + 1)]["draws"] = standing.draws;
+        root["leagueTables"][idStr]["standings"][std::to_string(index + 1)]["losses"] = standing.losses;
+        root["leagueTables"][idStr]["standings"][std::to_string(index + 1)]["scored"] = standing.scored;
+        root["leagueTables"][idStr]["standings"][std::to_string(index + 1)]["conceded"] = standing.conceded;
+    }
+}
+
+void SaveData::ConvertCupBracketToJSON(nlohmann::json& root, const KnockoutCup& cup) const
+{
+    const CupBracket& bracket = cup.GetBracket();
+    if (!bracket.IsDrawn())
+        return;
+
+    const std::string idStr = std::to_string(cup.GetID());
+    root["cupBrackets"][idStr]["entrants"] = bracket.GetEntrants();
+    root["cupBrackets"][idStr]["rounds"] = nlohmann::json::array();
+
+    for (const std::vector<CupBracket::Tie>& round : bracket.GetRounds())
+    {
+        std::vector<int> values;
+        values.reserve(round.size() * 3);
+
+        for (const CupBracket::Tie& tie : round)
+        {
+            values.emplace_back(tie.homeClubID);
+            values.emplace_back(tie.awayClubID);
+            values.emplace_back(tie.homeWon ? 1 : 0);
+        }
+
+        root["cupBrackets"][idStr]["rounds"].push_back(values);
+    }
+}
+
 const League* SaveData::GetCurrentLeague() const
 {
     return this->currentLeague;
@@ -608,6 +806,10 @@ UserProfile* SaveData::GetUser(uint16_t id)
 
 SaveData::Position* SaveData::GetPosition(uint16_t id)
 {
+    // Position IDs are loaded sequentially, so the ID is normally the position's index
+    if (id < this->positionDatabase.size() && this->positionDatabase[id].id == id)
+        return &this->positionDatabase[id];
+
     for (Position& position : this->positionDatabase)
     {
         if (position.id == id)
@@ -618,8 +820,29 @@ SaveData::Position* SaveData::GetPosition(uint16_t id)
     return nullptr;
 }
 
+bool SaveData::PositionTraits::IsCompatibleWith(uint16_t positionID) const
+{
+    return positionID < 32 && (this->compatiblePositions & (1u << positionID)) != 0;
+}
+
+const SaveData::PositionTraits& SaveData::GetPositionTraits(uint16_t id) const
+{
+    if (id < this->positionTraits.size())
+        return this->positionTraits[id];
+
+    // An unknown position has no traits set, so it isn't treated as a goalkeeper or compatible with any position
+    static const PositionTraits emptyTraits;
+
+    LogSystem::GetInstance().OutputLog("No position traits were found matching the ID: " + std::to_string(id), Severity::WARNING);
+    return emptyTraits;
+}
+
 Player* SaveData::GetPlayer(uint16_t id)
 {
+    // Player IDs are loaded sequentially and new players are given the next ID, so the ID is normally the player's index
+    if (id < this->playerDatabase.size() && this->playerDatabase[id].GetID() == id)
+        return &this->playerDatabase[id];
+
     for (Player& player : this->playerDatabase)
     {
         if (player.GetID() == id)
@@ -632,6 +855,10 @@ Player* SaveData::GetPlayer(uint16_t id)
 
 Club* SaveData::GetClub(uint16_t id)
 {
+    // Club IDs are loaded sequentially, so the ID is normally the club's index
+    if (id < this->clubDatabase.size() && this->clubDatabase[id].GetID() == id)
+        return &this->clubDatabase[id];
+
     for (Club& club : this->clubDatabase)
     {
         if (club.GetID() == id)
@@ -706,6 +933,21 @@ std::vector<KnockoutCup>& SaveData::GetCupDatabase()
     return this->cupDatabase;
 }
 
+ClubIndex& SaveData::GetClubIndex()
+{
+    return this->clubIndex;
+}
+
+CompetitionRankIndex& SaveData::GetCompetitionRankIndex()
+{
+    return this->competitionRankIndex;
+}
+
+NameIndex& SaveData::GetNameIndex()
+{
+    return this->nameIndex;
+}
+
 std::string_view SaveData::GetName() const
 {
     return this->name;
@@ -1,6 +1,9 @@
 #ifndef SAVE_DATA_H
 #define SAVE_DATA_H
 
+#include <serialization/club_index.h>
+#include <serialization/competition_rank_index.h>
+#include <serialization/name_index.h>
 #include <serialization/cup_group.h>
 #include <serialization/league_group.h>
 #include <serialization/club_entity.h>
@@ -42,6 +45,18 @@ public:
 		PositionCategory category;
 	};
 
+	// Position data which is derived once when the positions are loaded, so it doesn't have to be worked out for every player
+	struct PositionTraits
+	{
+		PositionCategory category = PositionCategory::GOALKEEPER;
+		Club::StaffType staffType = Club::StaffType::GOALKEEPING;
+		bool goalkeeper = false, attackingMinded = false;
+		uint32_t compatiblePositions = 0; // Bit mask of the position IDs a player in this position can also play in (including this one)
+
+		// Returns TRUE if a player in this position can also play in the position matching the ID given.
+		bool IsCompatibleWith(uint16_t positionID) const;
+	};
+
 	struct NegotiationCooldown
 	{
 		uint16_t playerID;
@@ -73,6 +88,11 @@ private:
 	std::vector<Club> clubDatabase;
 	std::vector<Player> playerDatabase;
 	std::vector<Position> positionDatabase;
+	std::vector<PositionTraits> positionTraits; // Indexed by position ID
+
+	ClubIndex clubIndex;
+	CompetitionRankIndex competitionRankIndex;
+	NameIndex nameIndex;
 private:
 	// Converts the data of the club given into JSON and inserts it into the JSON object given.
 	void ConvertClubToJSON(nlohmann::json& root, const Club& club) const;
@@ -88,6 +108,12 @@ private:
 
 	// Converts the data of the past transfer given into JSON and inserts it into the JSON object given.
 	void ConvertPastTransferToJSON(nlohmann::json& root, const PastTransfer& transfer, int index) const;
+
+	// Converts the table of the league given into JSON and inserts it into the JSON object given.
+	void ConvertLeagueTableToJSON(nlohmann::json& root, const League& league) const;
+
+	// Converts the bracket of the cup given into JSON and inserts it into the JSON object given.
+	void ConvertCupBracketToJSON(nlohmann::json& root, const KnockoutCup& cup) const;
 public:
 	SaveData();
 	SaveData(const SaveData& other) = delete;
@@ -110,6 +136,10 @@ public:
 	// Sets the league the users are currently competing for in this save.
 	void SetCurrentLeague(League* league);
 
+	// Appends the players given to the player database, their IDs must follow on from the last player's ID.
+	// The database may be reallocated, so the clubs' squads are pointed at the moved players and the name index is flagged as outdated.
+	void AddPlayers(const std::vector<Player>& players);
+
 	// Loads every user profile's data in the JSON structure into the vector.
 	// You must call the functions 'LoadClubsFromJSON()' before calling this one.
 	void LoadUsersFromJSON(const nlohmann::json& dataRoot);
@@ -117,10 +147,18 @@ public:
 	// Loads every cup competition's data in the JSON structure into the vector.
 	void LoadCupsFromJSON(const nlohmann::json& dataRoot);
 
+	// Loads the bracket of every cup competition in the JSON structure into the cups.
+	// Any brackets left over from a previously loaded save are cleared.
+	void LoadCupBracketsFromJSON(const nlohmann::json& dataRoot);
+
 	// Loads every league's data in the JSON structure into the vector. 
 	// You must call the functions 'LoadClubsFromJSON()' before calling this one.
 	void LoadLeaguesFromJSON(const nlohmann::json& dataRoot);
 
+	// Loads the standings of every league table in the JSON structure into the leagues.
+	// You must call the function 'LoadLeaguesFromJSON()' before calling this one.
+	void LoadLeagueTablesFromJSON(const nlohmann::json& dataRoot);
+
 	// Loads every club's data in the JSON structure into the vector. 
 	// You must call the function 'LoadPlayersFromJSON()' before calling this one.
 	void LoadClubsFromJSON(const nlohmann::json& dataRoot, bool loadingDefault = true);
@@ -152,6 +190,10 @@ public:
 	// If none is found matching the ID, then nullptr is returned.
 	Position* GetPosition(uint16_t id);
 
+	// Returns the precomputed traits of the position matching the ID given.
+	// If none is found matching the ID, then traits with nothing set are returned.
+	const PositionTraits& GetPositionTraits(uint16_t id) const;
+
 	// Returns the player matching the ID given.
 	// If none is found matching the ID, then nullptr is returned.
 	Player* GetPlayer(uint16_t id);
@@ -192,6 +234,15 @@ public:
 	// Returns the save's cup competition database.
 	std::vector<KnockoutCup>& GetCupDatabase();
 
+	// Returns the index of AI controlled clubs which have space in their squad, bucketed by average overall.
+	ClubIndex& GetClubIndex();
+
+	// Returns the index of the clubs taking part in each competition, ranked by average overall.
+	CompetitionRankIndex& GetCompetitionRankIndex();
+
+	// Returns the trigram index of the player and club names.
+	NameIndex& GetNameIndex();
+
 	// Returns the name of the save.
 	std::string_view GetName() const;
 
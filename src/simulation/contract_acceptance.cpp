@@ -0,0 +1,175 @@
+#include <simulation/contract_acceptance.h>
+#include <serialization/save_data.h>
+#include <util/data_manip.h>
+
+#include <cmath>
+
+namespace
+{
+    // The random multiplier the length preference weight is built from, and the weights outside of which the player asks for a shorter
+    // or longer contract
+    constexpr int minLengthMultiplier = 100, maxLengthMultiplier = 200;
+    constexpr int shorterLengthWeight = 300, longerLengthWeight = 600;
+}
+
+float ContractAcceptance::Surface::GetProbability(size_t lengthIndex, size_t wageIndex, size_t releaseClauseIndex) const
+{
+    return this->probabilities[(((lengthIndex * this->wages.size()) + wageIndex) * this->releaseClauses.size()) + releaseClauseIndex];
+}
+
+ContractAcceptance::Terms ContractAcceptance::Surface::GetSuggestedTerms(float minProbability, int maxWage) const
+{
+    Terms suggestedTerms, likeliestTerms;
+    bool foundSuggestion = false;
+
+    for (size_t lengthIndex = 0; lengthIndex < this->lengths.size(); lengthIndex++)
+    {
+        for (size_t wageIndex = 0; wageIndex < this->wages.size(); wageIndex++)
+        {
+            if (this->wages[wageIndex] > maxWage)
+                continue;
+
+            for (size_t releaseClauseIndex = 0; releaseClauseIndex < this->releaseClauses.size(); releaseClauseIndex++)
+            {
+                const Terms terms = { this->lengths[lengthIndex], this->wages[wageIndex], this->releaseClauses[releaseClauseIndex],
+                    this->GetProbability(lengthIndex, wageIndex, releaseClauseIndex) };
+
+                if (terms.probability > likeliestTerms.probability)
+                    likeliestTerms = terms;
+
+                if (terms.probability >= minProbability && (!foundSuggestion || terms.wage < suggestedTerms.wage ||
+                    (terms.wage == suggestedTerms.wage && terms.probability > suggestedTerms.probability)))
+                {
+                    suggestedTerms = terms;
+                    foundSuggestion = true;
+                }
+            }
+        }
+    }
+
+    return foundSuggestion ? suggestedTerms : likeliestTerms;
+}
+
+int ContractAcceptance::GetLengthPreferenceWeight(const Player& player, bool renewingContract, int contractLength, int multiplier)
+{
+    if (renewingContract)
+    {
+        const int contractYearsRemaining = player.GetExpiryYear() - SaveData::GetInstance().GetCurrentYear();
+        return (int)(((7 - (contractYearsRemaining + contractLength)) * multiplier) / (player.GetAge() / 20.0f));
+    }
+
+    return (int)(((7 - contractLength) * multiplier) / (player.GetAge() / 22.0f));
+}
+
+std::pair<int, int> ContractAcceptance::GetAcceptableWageRange(const Player& player)
+{
+    return { player.GetWage(), (int)(player.GetWage() * 2.25f) };
+}
+
+std::pair<int, int> ContractAcceptance::GetPreferredReleaseClauseRange(const Player& player)
+{
+    return { player.GetValue(), (int)(std::ceil((float)player.GetValue() * 1.5f)) };
+}
+
+float ContractAcceptance::GetReleaseClauseRequestThreshold(const Player& player)
+{
+    return 100.0f - ((16.0f / (float)player.GetAge()) * 55.0f);
+}
+
+float ContractAcceptance::GetLengthAcceptance(const Player& player, bool renewingContract, int contractLength)
+{
+    const int contractYearsRemaining = player.GetExpiryYear() - SaveData::GetInstance().GetCurrentYear();
+
+    // The player only keeps the length offered if the random multiplier leaves his preference weight in the middle band, or if he
+    // can't be offered anything shorter or longer
+    int timesAccepted = 0;
+    for (int multiplier = minLengthMultiplier; multiplier <= maxLengthMultiplier; multiplier++)
+    {
+        const int preferenceWeight = ContractAcceptance::GetLengthPreferenceWeight(player, renewingContract, contractLength, multiplier);
+        if ((preferenceWeight < shorterLengthWeight && contractLength > 1) || (preferenceWeight > longerLengthWeight && contractLength < 5))
+            continue;
+
+        if (renewingContract && contractYearsRemaining - 1 > 5)
+            continue;
+
+        ++timesAccepted;
+    }
+
+    return (float)timesAccepted / (float)(maxLengthMultiplier - minLengthMultiplier + 1);
+}
+
+float ContractAcceptance::GetWageAcceptance(const Player& player, int wage)
+{
+    // The player accepts any wage at or above the lowest wage he's willing to accept
+    const auto [min, max] = ContractAcceptance::GetAcceptableWageRange(player);
+    return (float)Util::CountTruncatedSFAtMost(min, max, wage, 3) / (float)(max - min + 1);
+}
+
+float ContractAcceptance::GetReleaseClauseAcceptance(const Player& player, int releaseClause)
+{
+    // Work out the chance of the player wanting a release clause at all
+    const float requestThreshold = ContractAcceptance::GetReleaseClauseRequestThreshold(player);
+
+    int timesRequested = 0;
+    for (int generatedNum = 0; generatedNum <= 100; generatedNum++)
+        timesRequested += ((float)generatedNum > requestThreshold) ? 1 : 0;
+
+    const float requestChance = (float)timesRequested / 101.0f;
+    if (releaseClause == 0 || timesRequested == 0)
+        return 1.0f - requestChance;
+
+    const auto [min, max] = ContractAcceptance::GetPreferredReleaseClauseRange(player);
+    if (min > max)
+        return 1.0f - requestChance;
+
+    // A preferred release clause which isn't above the player's current one is raised to the current one plus half of it, so the range is
+    // split into the part which is raised and the part which isn't
+    const int currentReleaseClause = player.GetReleaseClause();
+    const int lastRaised = min - 1 + Util::CountTruncatedSFAtMost(min, max, currentReleaseClause, 3);
+
+    const int minRaisedPreference = 2 * (releaseClause - currentReleaseClause);
+    const int raisedAccepted = (minRaisedPreference <= 0) ? (lastRaised - min + 1) :
+        (lastRaised - min + 1) - Util::CountTruncatedSFAtMost(min, lastRaised, minRaisedPreference - 1, 3);
+
+    const int unraisedAccepted = (max - lastRaised) - Util::CountTruncatedSFAtMost(lastRaised + 1, max, releaseClause - 1, 3);
+
+    // The release clause offered is accepted if it's no higher than the one the player would like
+    const float preferenceAcceptance = (float)(raisedAccepted + unraisedAccepted) / (float)(max - min + 1);
+    return (1.0f - requestChance) + (requestChance * preferenceAcceptance);
+}
+
+ContractAcceptance::Surface ContractAcceptance::Evaluate(const Player& player, bool renewingContract, const std::vector<int>& lengths,
+    const std::vector<int>& wages, const std::vector<int>& releaseClauses)
+{
+    Surface surface;
+    surface.lengths = lengths;
+    surface.wages = wages;
+    surface.releaseClauses = releaseClauses;
+
+    std::vector<float> lengthAcceptance(lengths.size()), wageAcceptance(wages.size()), releaseClauseAcceptance(releaseClauses.size());
+
+    for (size_t index = 0; index < lengths.size(); index++)
+        lengthAcceptance[index] = ContractAcceptance::GetLengthAcceptance(player, renewingContract, lengths[index]);
+
+    for (size_t index = 0; index < wages.size(); index++)
+        wageAcceptance[index] = ContractAcceptance::GetWageAcceptance(player, wages[index]);
+
+    for (size_t index = 0; index < releaseClauses.size(); index++)
+        releaseClauseAcceptance[index] = ContractAcceptance::GetReleaseClauseAcceptance(player, releaseClauses[index]);
+
+    // Fill in the surface, the innermost loop is a plain multiply over a contiguous row which the compiler can vectorize
+    surface.probabilities.resize(lengths.size() * wages.size() * releaseClauses.size());
+    float* probability = surface.probabilities.data();
+
+    for (size_t lengthIndex = 0; lengthIndex < lengths.size(); lengthIndex++)
+    {
+        for (size_t wageIndex = 0; wageIndex < wages.size(); wageIndex++)
+        {
+            const float termsAcceptance = lengthAcceptance[lengthIndex] * wageAcceptance[wageIndex];
+            for (size_t releaseClauseIndex = 0; releaseClauseIndex < releaseClauses.size(); releaseClauseIndex++)
+                *probability++ = termsAcceptance * releaseClauseAcceptance[releaseClauseIndex];
+        }
+    }
+
+    return surface;
+}
@@ -0,0 +1,62 @@
+#ifndef CONTRACT_ACCEPTANCE_H
+#define CONTRACT_ACCEPTANCE_H
+
+#include <serialization/player_entity.h>
+#include <utility>
+#include <vector>
+
+class ContractAcceptance
+{
+public:
+	struct Terms
+	{
+		int length = 0, wage = 0, releaseClause = 0;
+		float probability = 0.0f;
+	};
+
+	// The chance of the player accepting every combination of the contract lengths, wages and release clauses given
+	struct Surface
+	{
+		std::vector<int> lengths, wages, releaseClauses;
+		std::vector<float> probabilities; // Indexed by length, then wage, then release clause
+
+		// Returns the chance of the player accepting the terms at the grid indices given.
+		float GetProbability(size_t lengthIndex, size_t wageIndex, size_t releaseClauseIndex) const;
+
+		// Returns the terms on the grid with the lowest wage (no higher than the max wage given) which the player accepts with at least
+		// the chance given. If no terms are accepted with that chance, then the most likely terms within the max wage are returned.
+		Terms GetSuggestedTerms(float minProbability, int maxWage) const;
+	};
+public:
+	ContractAcceptance() = delete;
+
+	// Returns the preference weight the player gives the contract length given, a low weight means he wants a shorter contract and a
+	// high weight means he wants a longer contract. The multiplier is a random value from 100 to 200.
+	static int GetLengthPreferenceWeight(const Player& player, bool renewingContract, int contractLength, int multiplier);
+
+	// Returns the range the lowest wage the player is willing to accept is drawn from.
+	static std::pair<int, int> GetAcceptableWageRange(const Player& player);
+
+	// Returns the range the release clause the player would like is drawn from.
+	static std::pair<int, int> GetPreferredReleaseClauseRange(const Player& player);
+
+	// Returns the score a random number from 0 to 100 has to beat for the player to want a release clause.
+	static float GetReleaseClauseRequestThreshold(const Player& player);
+
+	// Returns the chance of the player accepting the contract length given without asking for a different length.
+	static float GetLengthAcceptance(const Player& player, bool renewingContract, int contractLength);
+
+	// Returns the chance of the player accepting the wage given without asking for a higher wage.
+	static float GetWageAcceptance(const Player& player, int wage);
+
+	// Returns the chance of the player accepting the release clause given (0 for no release clause), without asking for another one.
+	static float GetReleaseClauseAcceptance(const Player& player, int releaseClause);
+
+	// Returns the chance of the player accepting every combination of the contract lengths, wages and release clauses given.
+	// The player's responses to each term are independent of each other, so only one value is worked out per term and the surface
+	// is filled in with their products.
+	static Surface Evaluate(const Player& player, bool renewingContract, const std::vector<int>& lengths, const std::vector<int>& wages,
+		const std::vector<int>& releaseClauses);
+};
+
+#endif
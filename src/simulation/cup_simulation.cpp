@@ -0,0 +1,293 @@
+#include <simulation/cup_simulation.h>
+#include <simulation/league_simulation.h>
+#include <simulation/match_engine.h>
+#include <serialization/save_data.h>
+#include <util/random_engine.h>
+#include <util/parallel.h>
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_set>
+
+namespace
+{
+    // Salt mixed into the season's stream ID, so the cup streams don't overlap with other streams made from the save's seed
+    constexpr uint64_t seasonStreamSalt = 0x4355500000000000ull;
+
+    // Cups with more rounds than this aren't simulated, since the bracket would be far bigger than the number of clubs in the game
+    constexpr size_t maxRounds = 12;
+}
+
+uint64_t CupSimulation::GetSeasonSeed() const
+{
+    return RandomEngine::GetInstance().CreateStream(seasonStreamSalt | SaveData::GetInstance().GetCurrentYear()).GenerateSeed();
+}
+
+std::vector<uint16_t> CupSimulation::GetEntrants(const KnockoutCup& cup) const
+{
+    auto ranksAbove = [this](uint16_t first, uint16_t second)
+    {
+        if (this->clubStrengths[first] != this->clubStrengths[second])
+            return this->clubStrengths[first] > this->clubStrengths[second];
+
+        return first < second;
+    };
+
+    std::unordered_set<uint16_t> entrantIDs;
+    for (const League& league : SaveData::GetInstance().GetLeagueDatabase())
+    {
+        for (const League::CompetitionLink& link : league.GetLinkedCompetitions())
+        {
+            if (link.competitionID != cup.GetID())
+                continue;
+
+            // An empty list of qualifying positions means every club in the league enters
+            if (link.qualifyingTablePositions.empty())
+            {
+                for (const Club* club : league.GetClubs())
+                    entrantIDs.insert(club->GetID());
+
+                continue;
+            }
+
+            // Clubs qualify through their position in last season's final table, if the league doesn't have a finished table (e.g. in
+            // the first season of a save) then the clubs are ranked by strength instead
+            std::vector<uint16_t> ranking;
+            const int totalRounds = LeagueSimulation::GetTotalRounds(league);
+
+            if (totalRounds > 0 && league.GetTable().GetRoundsPlayed() >= totalRounds)
+            {
+                for (const LeagueTable::Standing& standing : league.GetTable().GetStandings())
+                    ranking.emplace_back(standing.clubID);
+            }
+            else
+            {
+                for (const Club* club : league.GetClubs())
+                    ranking.emplace_back(club->GetID());
+
+                std::sort(ranking.begin(), ranking.end(), ranksAbove);
+            }
+
+            for (uint8_t position : link.qualifyingTablePositions)
+            {
+                if (position >= 1 && position <= ranking.size())
+                    entrantIDs.insert(ranking[position - 1]);
+            }
+        }
+    }
+
+    // Seed the entrants by strength
+    std::vector<uint16_t> entrants(entrantIDs.begin(), entrantIDs.end());
+    std::sort(entrants.begin(), entrants.end(), ranksAbove);
+
+    // The bracket only has room for so many clubs, the lowest seeds miss out but the users' clubs are always kept in
+    const size_t maxEntrants = (size_t)1 << cup.GetRounds().size();
+    if (entrants.size() > maxEntrants)
+    {
+        std::unordered_set<uint16_t> userClubIDs;
+        for (UserProfile& user : SaveData::GetInstance().GetUsers())
+        {
+            if (entrantIDs.count(user.GetClub()->GetID()) > 0)
+                userClubIDs.insert(user.GetClub()->GetID());
+        }
+
+        size_t remainingPlaces = maxEntrants - std::min(userClubIDs.size(), maxEntrants);
+        entrants.erase(std::remove_if(entrants.begin(), entrants.end(), [&userClubIDs, &remainingPlaces](uint16_t clubID)
+            {
+                if (userClubIDs.count(clubID) > 0)
+                    return false;
+
+                if (remainingPlaces == 0)
+                    return true;
+
+                --remainingPlaces;
+                return false;
+            }), entrants.end());
+    }
+
+    return entrants;
+}
+
+std::unordered_map<uint16_t, int> CupSimulation::GetUserExitRounds(const KnockoutCup& cup) const
+{
+    std::unordered_map<uint16_t, int> exitRounds;
+    for (UserProfile& user : SaveData::GetInstance().GetUsers())
+    {
+        for (const UserProfile::CompetitionData& compStats : user.GetCompetitionData())
+        {
+            if (compStats.compID == cup.GetID())
+            {
+                exitRounds[user.GetClub()->GetID()] = compStats.seasonEndPosition;
+                break;
+            }
+        }
+    }
+
+    return exitRounds;
+}
+
+void CupSimulation::ApplyUserResults(KnockoutCup& cup, const std::unordered_map<uint16_t, int>& exitRounds) const
+{
+    CupBracket& bracket = cup.GetBracket();
+
+    for (const auto& [clubID, exitRound] : exitRounds)
+    {
+        // Nothing needs correcting if the user hasn't recorded the cup yet, or went out in a round which hasn't been played
+        if (exitRound <= 0 || exitRound > bracket.GetRoundsPlayed())
+            continue;
+
+        CupBracket::Tie* tie = bracket.GetTie((size_t)exitRound - 1, clubID);
+        if (!tie)
+            continue;
+
+        const bool userIsHome = (tie->homeClubID == clubID);
+        if (tie->homeWon != userIsHome)
+            continue;
+
+        tie->homeWon = !userIsHome;
+        bracket.ReplaceClub((size_t)exitRound, clubID, userIsHome ? tie->awayClubID : tie->homeClubID);
+    }
+}
+
+void CupSimulation::PlayRounds(KnockoutCup& cup, int targetRound, uint64_t seasonSeed, const std::unordered_map<uint16_t, int>& exitRounds) const
+{
+    CupBracket& bracket = cup.GetBracket();
+    const int totalRounds = (int)cup.GetRounds().size();
+
+    std::unordered_map<uint16_t, size_t> seeds;
+    for (size_t index = 0; index < bracket.GetEntrants().size(); index++)
+        seeds[bracket.GetEntrants()[index]] = index;
+
+    for (int round = bracket.GetRoundsPlayed(); round < targetRound; round++)
+    {
+        // Each round has its own stream, so a round's draw and results don't depend on how the season was split up into ticks
+        RandomStream stream(seasonSeed, ((uint64_t)cup.GetID() << 16) | (uint64_t)(round + 1));
+
+        // Work out how many ties are needed to leave the right number of clubs for the next round, if there's already few enough
+        // clubs left then every club gets a bye
+        std::vector<uint16_t> remainingClubs = bracket.GetRemainingClubs();
+        const size_t clubsThrough = (size_t)1 << (totalRounds - round - 1);
+
+        if (remainingClubs.size() <= clubsThrough)
+        {
+            bracket.AddRound({});
+            continue;
+        }
+
+        const size_t totalTies = remainingClubs.size() - clubsThrough;
+
+        // The highest seeds get the byes, the users' clubs never get one since the users play every round they've recorded
+        std::stable_partition(remainingClubs.begin(), remainingClubs.end(), [&exitRounds](uint16_t clubID) { return exitRounds.count(clubID) == 0; });
+
+        std::vector<uint16_t> drawnClubs(remainingClubs.begin() + (remainingClubs.size() - (totalTies * 2)), remainingClubs.end());
+        std::sort(drawnClubs.begin(), drawnClubs.end(), [&seeds](uint16_t first, uint16_t second) { return seeds[first] < seeds[second]; });
+
+        // Seeded draw, the top half of the drawn clubs are kept apart and each one is drawn against a random club from the bottom half
+        for (size_t index = drawnClubs.size() - 1; index > totalTies; index--)
+            std::swap(drawnClubs[index], drawnClubs[totalTies + (size_t)stream.GenerateRandom<int>(0, (int)(index - totalTies))]);
+
+        std::vector<CupBracket::Tie> ties(totalTies);
+        for (size_t index = 0; index < totalTies; index++)
+        {
+            CupBracket::Tie& tie = ties[index];
+            tie.homeClubID = drawnClubs[index];
+            tie.awayClubID = drawnClubs[totalTies + index];
+
+            if (stream.GenerateRandom<int>(0, 1) == 1)
+                std::swap(tie.homeClubID, tie.awayClubID);
+
+            // The users' clubs go through until the user records going out of the cup
+            auto homeExit = exitRounds.find(tie.homeClubID);
+            auto awayExit = exitRounds.find(tie.awayClubID);
+
+            if (homeExit != exitRounds.end())
+                tie.homeWon = (homeExit->second == 0 || round + 1 < homeExit->second);
+            else if (awayExit != exitRounds.end())
+                tie.homeWon = !(awayExit->second == 0 || round + 1 < awayExit->second);
+            else
+            {
+                const int homeStrength = this->clubStrengths[tie.homeClubID];
+                const int awayStrength = this->clubStrengths[tie.awayClubID];
+
+                const MatchEngine::Result result = MatchEngine::SimulateMatch(homeStrength, awayStrength, stream);
+                tie.homeWon = (result.homeGoals != result.awayGoals) ? (result.homeGoals > result.awayGoals) :
+                    MatchEngine::SimulateShootout(homeStrength, awayStrength, stream);
+            }
+        }
+
+        bracket.AddRound(ties);
+    }
+}
+
+void CupSimulation::SimulateUntil(float seasonProgress)
+{
+    MatchEngine::GatherClubStrengths(this->clubStrengths);
+
+    this->simulatedCups.clear();
+    this->targetRounds.clear();
+    this->userExitRounds.clear();
+
+    for (KnockoutCup& cup : SaveData::GetInstance().GetCupDatabase())
+    {
+        if (cup.GetRounds().empty() || cup.GetRounds().size() > maxRounds)
+            continue;
+
+        // Saves made before cups were simulated won't have had their cups drawn yet
+        if (!cup.GetBracket().IsDrawn())
+            cup.GetBracket().Reset(this->GetEntrants(cup));
+
+        if (!cup.GetBracket().IsDrawn())
+            continue;
+
+        const int totalRounds = (int)cup.GetRounds().size();
+        this->simulatedCups.emplace_back(&cup);
+        this->targetRounds.emplace_back(std::min((int)std::round(seasonProgress * (float)totalRounds), totalRounds));
+        this->userExitRounds.emplace_back(this->GetUserExitRounds(cup));
+    }
+
+    // Every cup is independent of the others, so they're all resolved at once
+    const uint64_t seasonSeed = this->GetSeasonSeed();
+    Util::ParallelFor(this->simulatedCups.size(), [this, seasonSeed](size_t begin, size_t end)
+        {
+            for (size_t index = begin; index < end; index++)
+            {
+                this->ApplyUserResults(*this->simulatedCups[index], this->userExitRounds[index]);
+                this->PlayRounds(*this->simulatedCups[index], this->targetRounds[index], seasonSeed, this->userExitRounds[index]);
+            }
+        }, 1);
+}
+
+void CupSimulation::DrawCups()
+{
+    MatchEngine::GatherClubStrengths(this->clubStrengths);
+
+    for (KnockoutCup& cup : SaveData::GetInstance().GetCupDatabase())
+    {
+        if (!cup.GetRounds().empty() && cup.GetRounds().size() <= maxRounds)
+            cup.GetBracket().Reset(this->GetEntrants(cup));
+        else
+            cup.GetBracket().Reset({});
+    }
+}
+
+void CupSimulation::ClearCups()
+{
+    for (KnockoutCup& cup : SaveData::GetInstance().GetCupDatabase())
+        cup.GetBracket().Reset({});
+}
+
+void CupSimulation::AdvanceCups()
+{
+    this->SimulateUntil(LeagueSimulation::GetInstance().GetSeasonProgress());
+}
+
+void CupSimulation::CompleteCups()
+{
+    this->SimulateUntil(1.0f);
+}
+
+CupSimulation& CupSimulation::GetInstance()
+{
+    static CupSimulation instance;
+    return instance;
+}
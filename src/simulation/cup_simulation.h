@@ -0,0 +1,65 @@
+#ifndef CUP_SIMULATION_H
+#define CUP_SIMULATION_H
+
+#include <serialization/cup_group.h>
+#include <util/random_stream.h>
+
+#include <unordered_map>
+#include <vector>
+
+class CupSimulation
+{
+private:
+	std::vector<int> clubStrengths; // Indexed by club ID
+
+	std::vector<KnockoutCup*> simulatedCups;
+	std::vector<int> targetRounds;
+
+	// The round (starting from 1) each user club went out of each simulated cup, rounds + 1 if the club won the cup and 0 if the user 
+	// hasn't recorded the cup yet
+	std::vector<std::unordered_map<uint16_t, int>> userExitRounds;
+private:
+	CupSimulation() = default;
+
+	// Returns the seed this season's draws and results are drawn from.
+	uint64_t GetSeasonSeed() const;
+
+	// Returns the clubs which enter the cup given this season, ordered by seed.
+	// Entrants come from the leagues linked to the cup, either the whole league or the clubs in the qualifying table positions.
+	std::vector<uint16_t> GetEntrants(const KnockoutCup& cup) const;
+
+	// Notes down the round each user club went out of the cup given.
+	std::unordered_map<uint16_t, int> GetUserExitRounds(const KnockoutCup& cup) const;
+
+	// Corrects the bracket for user clubs which recorded going out in a round that has already been played.
+	// The user club's opponent in that round goes through instead, and takes over the user club's place in the later rounds.
+	void ApplyUserResults(KnockoutCup& cup, const std::unordered_map<uint16_t, int>& exitRounds) const;
+
+	// Draws and plays the cup's rounds from the next unplayed round up to the round given.
+	// This only touches the cup's own bracket, so it is safe to run for different cups in parallel.
+	void PlayRounds(KnockoutCup& cup, int targetRound, uint64_t seasonSeed, const std::unordered_map<uint16_t, int>& exitRounds) const;
+
+	// Plays every cup up to the fraction of its rounds given.
+	void SimulateUntil(float seasonProgress);
+public:
+	CupSimulation(const CupSimulation& other) = delete;
+	CupSimulation(CupSimulation&& temp) noexcept = delete;
+	~CupSimulation() = default;
+
+	// Draws the entrants of every cup for the new season.
+	void DrawCups();
+
+	// Clears the bracket of every cup, so they're drawn again for the current save.
+	void ClearCups();
+
+	// Plays every cup up to the point in the season the users have reached in their league.
+	void AdvanceCups();
+
+	// Plays the remaining rounds of every cup.
+	void CompleteCups();
+
+	// Returns singleton instance object of this class.
+	static CupSimulation& GetInstance();
+};
+
+#endif
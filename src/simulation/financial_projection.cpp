@@ -0,0 +1,343 @@
+#include <simulation/financial_projection.h>
+#include <simulation/match_engine.h>
+#include <serialization/save_data.h>
+#include <util/random_engine.h>
+#include <util/data_manip.h>
+#include <util/parallel.h>
+#include <util/globals.h>
+
+#include <algorithm>
+
+namespace
+{
+    // Salt mixed into the season's stream ID, so the projection streams don't overlap with other streams made from the save's seed
+    constexpr uint64_t seasonStreamSalt = 0x46494E0000000000ull;
+
+    // The number of sampled futures the bands are taken from, and the most seasons which can be projected ahead
+    constexpr size_t totalSamples = 512;
+    constexpr int maxSeasons = 5;
+
+    // How far above or below its strength a club can play over a season, the league table is sampled by ranking the clubs on their
+    // strength plus this random swing in form
+    constexpr float formSwing = 3.0f;
+}
+
+void FinancialProjection::GatherInputs(const Club& club, const Signing& signing)
+{
+    this->inputs.budgets.transferBudget = club.GetTransferBudget() - signing.transferFee;
+    this->inputs.budgets.wageBudget = club.GetWageBudget() - signing.wage;
+    this->inputs.budgets.initialTransferBudget = club.GetInitialTransferBudget();
+    this->inputs.budgets.initialWageBudget = club.GetInitialWageBudget();
+
+    this->inputs.objectives = club.GetObjectives();
+    this->inputs.clubStrength = MatchEngine::GetClubStrength(club);
+    this->inputs.startYear = SaveData::GetInstance().GetCurrentYear();
+    this->inputs.leagueID = club.GetLeague();
+
+    // Note down the wage commitments of every contract at the club
+    this->inputs.contracts.clear();
+    for (const Player* player : club.GetPlayers())
+    {
+        this->inputs.contracts.push_back({ player->GetWage(), player->GetExpiryYear(),
+            SaveData::GetInstance().GetPositionTraits(player->GetPosition()).goalkeeper });
+    }
+
+    if (signing.wage > 0)
+        this->inputs.contracts.push_back({ signing.wage, signing.expiryYear, signing.goalkeeper });
+
+    // Note down the strengths of the club's league rivals and cup opponents
+    this->inputs.leagueStrengths.clear();
+    this->inputs.cupStrengths.clear();
+    this->inputs.cupIDs.clear();
+
+    const League* league = SaveData::GetInstance().GetLeague(club.GetLeague());
+    if (!league)
+        return;
+
+    for (const Club* rival : league->GetClubs())
+    {
+        if (rival->GetID() != club.GetID())
+            this->inputs.leagueStrengths.emplace_back(MatchEngine::GetClubStrength(*rival));
+    }
+
+    for (const League::CompetitionLink& link : league->GetLinkedCompetitions())
+    {
+        const KnockoutCup* cup = SaveData::GetInstance().GetCup(link.competitionID);
+        if (!cup || cup->GetRounds().empty())
+            continue;
+
+        // The cup's opponents are whoever was drawn in it this season, or the club's league rivals if it hasn't been drawn
+        std::vector<int> opponentStrengths;
+        if (cup->GetBracket().IsDrawn())
+        {
+            for (uint16_t entrantID : cup->GetBracket().GetEntrants())
+            {
+                if (entrantID != club.GetID())
+                    opponentStrengths.emplace_back(MatchEngine::GetClubStrength(*SaveData::GetInstance().GetClub(entrantID)));
+            }
+        }
+
+        if (opponentStrengths.empty())
+            opponentStrengths = this->inputs.leagueStrengths;
+
+        this->inputs.cupIDs.emplace_back(cup->GetID());
+        this->inputs.cupStrengths.emplace_back(std::move(opponentStrengths));
+    }
+}
+
+FinancialProjection::SeasonOutcome FinancialProjection::SampleSeason(RandomStream& stream) const
+{
+    SeasonOutcome outcome;
+
+    // The league position is the number of rivals who had a better season than the club
+    const float clubForm = (float)this->inputs.clubStrength + stream.GenerateRandom<float>(-formSwing, formSwing) +
+        stream.GenerateRandom<float>(-formSwing, formSwing);
+
+    int leaguePosition = 1;
+    for (int rivalStrength : this->inputs.leagueStrengths)
+    {
+        const float rivalForm = (float)rivalStrength + stream.GenerateRandom<float>(-formSwing, formSwing) +
+            stream.GenerateRandom<float>(-formSwing, formSwing);
+
+        if (rivalForm > clubForm)
+            ++leaguePosition;
+    }
+
+    // Clubs which finish in the playoff places have an equal chance of winning the playoffs
+    bool wonPlayoffs = false;
+    const League* league = SaveData::GetInstance().GetLeague(this->inputs.leagueID);
+
+    if (leaguePosition > league->GetAutoPromotionThreshold() && leaguePosition <= league->GetPlayoffsThreshold())
+        wonPlayoffs = stream.GenerateRandom<int>(1, league->GetPlayoffsThreshold() - league->GetAutoPromotionThreshold()) == 1;
+
+    FinancialProjection::EvaluateCompetition(this->inputs.objectives, this->inputs.leagueID, leaguePosition, wonPlayoffs, outcome);
+
+    // The club plays each round of the cups until it's knocked out, against an opponent drawn at random from the cup's entrants
+    for (size_t cupIndex = 0; cupIndex < this->inputs.cupIDs.size(); cupIndex++)
+    {
+        const std::vector<int>& opponentStrengths = this->inputs.cupStrengths[cupIndex];
+        const int totalRounds = (int)SaveData::GetInstance().GetCup(this->inputs.cupIDs[cupIndex])->GetRounds().size();
+
+        int seasonEndPosition = totalRounds + 1;
+        for (int round = 0; round < totalRounds; round++)
+        {
+            const int opponentStrength = opponentStrengths.empty() ? this->inputs.clubStrength :
+                opponentStrengths[(size_t)stream.GenerateRandom<int>(0, (int)opponentStrengths.size() - 1)];
+
+            const MatchEngine::Result result = MatchEngine::SimulateMatch(this->inputs.clubStrength, opponentStrength, stream);
+            const bool wonRound = (result.homeGoals != result.awayGoals) ? (result.homeGoals > result.awayGoals) :
+                MatchEngine::SimulateShootout(this->inputs.clubStrength, opponentStrength, stream);
+
+            if (!wonRound)
+            {
+                seasonEndPosition = round + 1;
+                break;
+            }
+        }
+
+        FinancialProjection::EvaluateCompetition(this->inputs.objectives, this->inputs.cupIDs[cupIndex], seasonEndPosition, false, outcome);
+    }
+
+    return outcome;
+}
+
+void FinancialProjection::ProcessExpiredContracts(std::vector<Contract>& contracts, Budgets& budgets, int year, RandomStream& stream)
+{
+    int totalGoalkeepers = 0;
+    for (const Contract& contract : contracts)
+        totalGoalkeepers += contract.goalkeeper ? 1 : 0;
+
+    const int totalOutfielders = (int)contracts.size() - totalGoalkeepers;
+    int releasedGoalkeepers = 0, releasedOutfielders = 0;
+
+    // The same rule as the new season setup, expired contracts are renewed on a higher wage if the squad is at its minimum size,
+    // otherwise the player leaves on a free and his wages are handed back
+    auto contract = contracts.begin();
+    while (contract != contracts.end())
+    {
+        if (contract->expiryYear - year > 0)
+        {
+            contract++;
+            continue;
+        }
+
+        const int contractLength = stream.GenerateRandom<int>(2, 5);
+        if ((contract->goalkeeper && totalGoalkeepers - releasedGoalkeepers <= Globals::minGoalkeepers) ||
+            (!contract->goalkeeper && totalOutfielders - releasedOutfielders <= Globals::minOutfielders))
+        {
+            const int previousWage = contract->wage;
+            contract->wage = (int)(contract->wage * stream.GenerateRandom<float>(1.25f, 2.0f));
+            contract->expiryYear += contractLength;
+
+            budgets.wageBudget -= contract->wage - previousWage;
+            contract++;
+        }
+        else
+        {
+            budgets.wageBudget += contract->wage;
+
+            if (contract->goalkeeper)
+                ++releasedGoalkeepers;
+            else
+                ++releasedOutfielders;
+
+            contract = contracts.erase(contract);
+        }
+    }
+}
+
+void FinancialProjection::RunSample(size_t sampleIndex, int totalSeasons, uint64_t seed, std::vector<Contract>& contracts)
+{
+    RandomStream stream(seed, sampleIndex);
+
+    Budgets budgets = this->inputs.budgets;
+    contracts = this->inputs.contracts;
+
+    for (int season = 0; season < totalSeasons; season++)
+    {
+        FinancialProjection::ApplyBudgetRules(budgets, this->SampleSeason(stream));
+        FinancialProjection::ProcessExpiredContracts(contracts, budgets, this->inputs.startYear + season + 1, stream);
+
+        this->transferSamples[(size_t)season * totalSamples + sampleIndex] = budgets.transferBudget;
+        this->wageSamples[(size_t)season * totalSamples + sampleIndex] = budgets.wageBudget;
+    }
+}
+
+FinancialProjection::Band FinancialProjection::GetBand(std::vector<int>::iterator begin, std::vector<int>::iterator end)
+{
+    const size_t totalValues = (size_t)(end - begin);
+
+    // Each partial sort leaves everything below the percentile before it, so the next one only has to search the values above it
+    Band band;
+    std::nth_element(begin, begin + (totalValues / 10), end);
+    band.lower = *(begin + (totalValues / 10));
+
+    std::nth_element(begin + (totalValues / 10), begin + (totalValues / 2), end);
+    band.median = *(begin + (totalValues / 2));
+
+    std::nth_element(begin + (totalValues / 2), begin + ((totalValues * 9) / 10), end);
+    band.upper = *(begin + ((totalValues * 9) / 10));
+
+    return band;
+}
+
+FinancialProjection::Projection FinancialProjection::Project(const Club& club, int totalSeasons)
+{
+    return this->Project(club, totalSeasons, Signing());
+}
+
+FinancialProjection::Projection FinancialProjection::Project(const Club& club, int totalSeasons, const Signing& signing)
+{
+    totalSeasons = std::clamp(totalSeasons, 1, maxSeasons);
+
+    Projection projection;
+    if (!SaveData::GetInstance().GetLeague(club.GetLeague()))
+        return projection;
+
+    this->GatherInputs(club, signing);
+    this->transferSamples.resize((size_t)totalSeasons * totalSamples);
+    this->wageSamples.resize((size_t)totalSeasons * totalSamples);
+
+    // Every club gets its own set of streams, so projecting one club doesn't change another club's bands
+    const uint64_t seed = RandomEngine::GetInstance().CreateStream(seasonStreamSalt | this->inputs.startYear).GenerateSeed() ^
+        ((uint64_t)club.GetID() << 32);
+
+    Util::ParallelFor(totalSamples, [this, totalSeasons, seed](size_t begin, size_t end)
+        {
+            std::vector<Contract> contracts;
+            for (size_t index = begin; index < end; index++)
+                this->RunSample(index, totalSeasons, seed, contracts);
+        }, 32);
+
+    for (int season = 0; season < totalSeasons; season++)
+    {
+        const size_t offset = (size_t)season * totalSamples;
+        projection.transferBudgets.emplace_back(FinancialProjection::GetBand(this->transferSamples.begin() + offset,
+            this->transferSamples.begin() + offset + totalSamples));
+        projection.wageBudgets.emplace_back(FinancialProjection::GetBand(this->wageSamples.begin() + offset,
+            this->wageSamples.begin() + offset + totalSamples));
+    }
+
+    return projection;
+}
+
+void FinancialProjection::EvaluateCompetition(const std::vector<Club::Objective>& objectives, uint16_t compID, int seasonEndPosition,
+    bool wonPlayoffs, SeasonOutcome& outcome)
+{
+    // Add the revenue bonuses from the competitions won by the club
+    if (compID >= 1000) // DOMESTIC CUP COMPETITION
+    {
+        const KnockoutCup* cup = SaveData::GetInstance().GetCup(compID);
+        if (seasonEndPosition == (int)cup->GetRounds().size() + 1) // The club won the cup?
+            outcome.winnerBonus += cup->GetWinnerBonus();
+        else if (seasonEndPosition == (int)cup->GetRounds().size()) // The club are runners up?
+            outcome.winnerBonus += (int)(cup->GetWinnerBonus() / 2.5f);
+    }
+    else // LEAGUE COMPETITION
+    {
+        const League* league = SaveData::GetInstance().GetLeague(compID);
+        if (seasonEndPosition == 1)
+            outcome.winnerBonus += league->GetTitleBonus();
+        else if (wonPlayoffs || (seasonEndPosition <= league->GetAutoPromotionThreshold() && seasonEndPosition != 0))
+            outcome.winnerBonus += (int)(league->GetTitleBonus() / 2.5f);
+    }
+
+    // Tally up the club objectives that weren't completed, and add a revenue bonus per objective that was
+    for (const Club::Objective& objective : objectives)
+    {
+        if (objective.compID == compID)
+        {
+            if ((compID > 1000 && seasonEndPosition >= objective.targetEndPosition) ||
+                (compID < 1000 && seasonEndPosition <= objective.targetEndPosition))
+            {
+                outcome.objectiveBonus += 0.4f / (float)objectives.size();
+            }
+            else
+            {
+                ++outcome.objectivesIncomplete;
+            }
+
+            break;
+        }
+    }
+}
+
+FinancialProjection::SeasonOutcome FinancialProjection::GetRecordedOutcome(const UserProfile& user)
+{
+    SeasonOutcome outcome;
+    for (const UserProfile::CompetitionData& compStats : user.GetCompetitionData())
+    {
+        // Tally up the total games won, drawn and lost
+        outcome.gamesWon += compStats.currentWins;
+        outcome.gamesDrawn += compStats.currentDraws;
+        outcome.gamesLost += compStats.currentLosses;
+
+        FinancialProjection::EvaluateCompetition(user.GetClub()->GetObjectives(), compStats.compID, compStats.seasonEndPosition,
+            compStats.wonPlayoffs, outcome);
+    }
+
+    return outcome;
+}
+
+void FinancialProjection::ApplyBudgetRules(Budgets& budgets, const SeasonOutcome& outcome)
+{
+    // The club's base budgets grow with the objectives completed, any budget left over on top of the base budget carries over
+    const int previousInitialWageBudget = budgets.initialWageBudget;
+    budgets.initialWageBudget = Util::GetTruncatedSFInteger((int)((float)budgets.initialWageBudget * outcome.objectiveBonus), 3);
+
+    budgets.wageBudget = budgets.wageBudget > budgets.initialWageBudget ?
+        budgets.wageBudget + (budgets.initialWageBudget - previousInitialWageBudget) : budgets.initialWageBudget;
+
+    const int previousInitialTransferBudget = budgets.initialTransferBudget;
+    budgets.initialTransferBudget = Util::GetTruncatedSFInteger((int)((float)budgets.initialTransferBudget * outcome.objectiveBonus), 4);
+
+    budgets.transferBudget = budgets.transferBudget > budgets.initialTransferBudget ?
+        budgets.transferBudget + outcome.winnerBonus + (budgets.initialTransferBudget - previousInitialTransferBudget) :
+        budgets.initialTransferBudget + outcome.winnerBonus;
+}
+
+FinancialProjection& FinancialProjection::GetInstance()
+{
+    static FinancialProjection instance;
+    return instance;
+}
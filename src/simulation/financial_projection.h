@@ -0,0 +1,107 @@
+#ifndef FINANCIAL_PROJECTION_H
+#define FINANCIAL_PROJECTION_H
+
+#include <serialization/user_profile.h>
+#include <util/random_stream.h>
+#include <vector>
+
+class FinancialProjection
+{
+public:
+	// The parts of a season's results which the club's finances depend on
+	struct SeasonOutcome
+	{
+		int gamesWon = 0, gamesDrawn = 0, gamesLost = 0, winnerBonus = 0, objectivesIncomplete = 0;
+		float objectiveBonus = 1.0f;
+	};
+
+	struct Budgets
+	{
+		int transferBudget = 0, wageBudget = 0, initialTransferBudget = 0, initialWageBudget = 0;
+	};
+
+	// A player the user is considering signing, the projection is made as if the deal had gone through
+	struct Signing
+	{
+		int transferFee = 0, wage = 0, expiryYear = 0;
+		bool goalkeeper = false;
+	};
+
+	// The 10th, 50th and 90th percentiles of a projected budget
+	struct Band
+	{
+		int lower = 0, median = 0, upper = 0;
+	};
+
+	// The projected budgets at the start of each of the seasons ahead, the first band is for next season
+	struct Projection
+	{
+		std::vector<Band> transferBudgets, wageBudgets;
+	};
+private:
+	struct Contract
+	{
+		int wage, expiryYear;
+		bool goalkeeper;
+	};
+
+	// Everything a sample needs from the save, gathered up front so the samples can be run in parallel without touching the save
+	struct ProjectionInputs
+	{
+		Budgets budgets;
+		std::vector<Contract> contracts;
+		std::vector<Club::Objective> objectives;
+		std::vector<int> leagueStrengths; // The strengths of the other clubs in the club's league
+		std::vector<std::vector<int>> cupStrengths; // The strengths of the possible opponents in each of the league's cups
+		std::vector<uint16_t> cupIDs;
+		uint16_t leagueID = 0;
+		int clubStrength = 0, startYear = 0;
+	};
+
+	ProjectionInputs inputs;
+	std::vector<int> transferSamples, wageSamples; // Indexed by season then sample
+private:
+	FinancialProjection() = default;
+
+	// Gathers the club's budgets, contracts, objectives and opponents into the projection inputs.
+	void GatherInputs(const Club& club, const Signing& signing);
+
+	// Runs a single sampled future of the club's finances, writing its budgets at the start of each season ahead.
+	void RunSample(size_t sampleIndex, int totalSeasons, uint64_t seed, std::vector<Contract>& contracts);
+
+	// Returns a randomly drawn outcome of a season, assuming the club stays in its current league and keeps its current objectives.
+	SeasonOutcome SampleSeason(RandomStream& stream) const;
+
+	// Releases or renews the contracts which have run out by the year given, in the same way as the new season setup does.
+	static void ProcessExpiredContracts(std::vector<Contract>& contracts, Budgets& budgets, int year, RandomStream& stream);
+
+	// Returns the percentile band of the samples in the range given, the samples are reordered in the process.
+	static Band GetBand(std::vector<int>::iterator begin, std::vector<int>::iterator end);
+public:
+	FinancialProjection(const FinancialProjection& other) = delete;
+	FinancialProjection(FinancialProjection&& temp) noexcept = delete;
+	~FinancialProjection() = default;
+
+	// Returns the bands of the transfer and wage budgets of the club given over the number of seasons ahead given (from 1 to 5).
+	// The samples are drawn from a seed fixed for the season, so projecting the same club twice gives the same bands.
+	Projection Project(const Club& club, int totalSeasons);
+
+	// Returns the bands of the transfer and wage budgets of the club given over the number of seasons ahead given (from 1 to 5), as if 
+	// the club had made the signing given.
+	Projection Project(const Club& club, int totalSeasons, const Signing& signing);
+
+	// Adds the winner bonus and objective bonus earned by finishing the competition given in the position given to the outcome.
+	static void EvaluateCompetition(const std::vector<Club::Objective>& objectives, uint16_t compID, int seasonEndPosition, bool wonPlayoffs,
+		SeasonOutcome& outcome);
+
+	// Returns the outcome of the season which the user has recorded.
+	static SeasonOutcome GetRecordedOutcome(const UserProfile& user);
+
+	// Updates the budgets given for the next season, following a season with the outcome given.
+	static void ApplyBudgetRules(Budgets& budgets, const SeasonOutcome& outcome);
+
+	// Returns singleton instance object of this class.
+	static FinancialProjection& GetInstance();
+};
+
+#endif
@@ -0,0 +1,345 @@
+#include <simulation/league_simulation.h>
+#include <simulation/match_engine.h>
+#include <serialization/save_data.h>
+#include <util/random_engine.h>
+#include <util/parallel.h>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace
+{
+    // Salt mixed into the season's stream ID, so the league streams don't overlap with other streams made from the save's seed
+    constexpr uint64_t seasonStreamSalt = 0x4C45414755450000ull;
+}
+
+LeagueSimulation::Schedule LeagueSimulation::GenerateSchedule(size_t totalClubs)
+{
+    // An odd number of clubs is padded with a dummy club, whoever is drawn against it has the round off
+    const size_t totalSlots = totalClubs + (totalClubs % 2);
+    const size_t roundsPerHalf = totalSlots - 1;
+
+    Schedule schedule(roundsPerHalf * 2);
+    for (size_t round = 0; round < roundsPerHalf; round++)
+    {
+        for (size_t match = 0; match < totalSlots / 2; match++)
+        {
+            // The last slot stays fixed while the other slots rotate around it
+            size_t home = (round + match) % roundsPerHalf;
+            size_t away = (match == 0) ? roundsPerHalf : (round + roundsPerHalf - match) % roundsPerHalf;
+
+            // Alternate who plays at home, so no club plays a long run of home or away games
+            if ((match == 0 && round % 2 == 1) || (match > 0 && match % 2 == 1))
+                std::swap(home, away);
+
+            if (home >= totalClubs || away >= totalClubs)
+                continue;
+
+            // The second half of the season is the first half again with the home and away sides switched
+            schedule[round].push_back({ (uint8_t)home, (uint8_t)away });
+            schedule[round + roundsPerHalf].push_back({ (uint8_t)away, (uint8_t)home });
+        }
+    }
+
+    return schedule;
+}
+
+uint64_t LeagueSimulation::GetSeasonSeed() const
+{
+    // Derived from the save's seed rather than drawn from the main stream, so the fixtures stay the same no matter how many times the
+    // season is advanced or the save is reloaded
+    return RandomEngine::GetInstance().CreateStream(seasonStreamSalt | SaveData::GetInstance().GetCurrentYear()).GenerateSeed();
+}
+
+MatchEngine::Result LeagueSimulation::TakeUserResult(LeagueTable::Standing& results)
+{
+    const int gamesLeft = results.GetPlayed();
+
+    // Take whichever outcome the user has the most of left, so the wins, draws and losses are spread out over the games
+    const bool win = results.wins >= results.draws && results.wins >= results.losses;
+    const bool loss = !win && results.losses > results.draws;
+    const int remainingWins = results.wins - (win ? 1 : 0);
+    const int remainingLosses = results.losses - (loss ? 1 : 0);
+
+    MatchEngine::Result result;
+    if (gamesLeft <= 1)
+    {
+        // The last game takes whatever goals are left, so the goals add up to the user's totals
+        result.homeGoals = results.scored;
+        result.awayGoals = results.conceded;
+    }
+    else
+    {
+        // Leave at least a goal scored for each win left and a goal conceded for each loss left
+        const int spareScored = std::max(results.scored - remainingWins, 0);
+        const int spareConceded = std::max(results.conceded - remainingLosses, 0);
+        const int averageScored = results.scored / gamesLeft;
+        const int averageConceded = results.conceded / gamesLeft;
+
+        if (win)
+        {
+            result.awayGoals = std::min(averageConceded, spareConceded);
+            result.homeGoals = std::min(std::max(averageScored, result.awayGoals + 1), spareScored);
+            result.awayGoals = std::min(result.awayGoals, std::max(result.homeGoals - 1, 0));
+        }
+        else if (loss)
+        {
+            result.homeGoals = std::min(averageScored, spareScored);
+            result.awayGoals = std::min(std::max(averageConceded, result.homeGoals + 1), spareConceded);
+            result.homeGoals = std::min(result.homeGoals, std::max(result.awayGoals - 1, 0));
+        }
+        else
+        {
+            result.homeGoals = std::min({ averageScored, averageConceded, spareScored, spareConceded });
+            result.awayGoals = result.homeGoals;
+        }
+    }
+
+    LeagueSimulation::RemoveUserResult(results, result.homeGoals, result.awayGoals);
+    return result;
+}
+
+void LeagueSimulation::RemoveUserResult(LeagueTable::Standing& results, int scored, int conceded)
+{
+    if (scored > conceded && results.wins > 0)
+        --results.wins;
+    else if (scored < conceded && results.losses > 0)
+        --results.losses;
+    else if (scored == conceded && results.draws > 0)
+        --results.draws;
+    else if (results.wins > 0)
+        --results.wins;
+    else if (results.draws > 0)
+        --results.draws;
+    else
+        --results.losses;
+
+    results.scored = std::max(results.scored - scored, 0);
+    results.conceded = std::max(results.conceded - conceded, 0);
+}
+
+void LeagueSimulation::PlayRounds(League& league, int targetRound, uint64_t seasonSeed)
+{
+    const std::vector<Club*>& clubs = league.GetClubs();
+    const Schedule& schedule = this->schedules.at(clubs.size());
+    LeagueTable& table = league.GetTable();
+
+    // Shuffle the order of the clubs, so each season's fixture list is different
+    RandomStream orderStream(seasonSeed, (uint64_t)league.GetID() << 16);
+
+    std::vector<size_t> clubOrder(clubs.size());
+    std::iota(clubOrder.begin(), clubOrder.end(), 0);
+
+    for (size_t index = clubOrder.size() - 1; index > 0; index--)
+        std::swap(clubOrder[index], clubOrder[orderStream.GenerateRandom<int>(0, (int)index)]);
+
+    for (int round = table.GetRoundsPlayed(); round < targetRound; round++)
+    {
+        // Each round has its own stream, so a round's results don't depend on how the season was split up into ticks
+        RandomStream matchStream(seasonSeed, ((uint64_t)league.GetID() << 16) | (uint64_t)(round + 1));
+
+        for (const auto& [homeIndex, awayIndex] : schedule[round])
+        {
+            const Club* homeClub = clubs[clubOrder[homeIndex]];
+            const Club* awayClub = clubs[clubOrder[awayIndex]];
+
+            // Every fixture is simulated, even the users' ones, so the other fixtures' results don't depend on what the users have recorded
+            MatchEngine::Result result = MatchEngine::SimulateMatch(this->clubStrengths[homeClub->GetID()],
+                this->clubStrengths[awayClub->GetID()], matchStream);
+
+            // Only the totals of the users' results are recorded, so the users' fixtures are given games taken out of those totals. This keeps
+            // the opponents' games played in line with the rest of the league. Fixtures the users haven't got to yet keep the simulated result.
+            LeagueTable::Standing* homeResults = nullptr;
+            LeagueTable::Standing* awayResults = nullptr;
+
+            if (this->userControlled[homeClub->GetID()] && this->unplayedUserResults.count(homeClub->GetID()) > 0)
+                homeResults = &this->unplayedUserResults.at(homeClub->GetID());
+
+            if (this->userControlled[awayClub->GetID()] && this->unplayedUserResults.count(awayClub->GetID()) > 0)
+                awayResults = &this->unplayedUserResults.at(awayClub->GetID());
+
+            if (homeResults && homeResults->GetPlayed() > 0)
+            {
+                result = LeagueSimulation::TakeUserResult(*homeResults);
+
+                // When two users play each other, the game comes out of both of their results
+                if (awayResults && awayResults->GetPlayed() > 0)
+                    LeagueSimulation::RemoveUserResult(*awayResults, result.awayGoals, result.homeGoals);
+            }
+            else if (awayResults && awayResults->GetPlayed() > 0)
+            {
+                const MatchEngine::Result userResult = LeagueSimulation::TakeUserResult(*awayResults);
+                result.homeGoals = userResult.awayGoals;
+                result.awayGoals = userResult.homeGoals;
+            }
+
+            table.RecordResult(homeClub->GetID(), awayClub->GetID(), result.homeGoals, result.awayGoals);
+        }
+    }
+
+    table.SetRoundsPlayed(targetRound);
+}
+
+void LeagueSimulation::ApplyUserResults() const
+{
+    League* currentLeague = SaveData::GetInstance().GetLeague(SaveData::GetInstance().GetCurrentLeague()->GetID());
+
+    // The users' standings come entirely from the results they recorded, rather than from the games shared out to their fixtures
+    for (UserProfile& user : SaveData::GetInstance().GetUsers())
+    {
+        if (user.GetClub()->GetLeague() != currentLeague->GetID())
+            continue;
+
+        for (const UserProfile::CompetitionData& compStats : user.GetCompetitionData())
+        {
+            if (compStats.compID == currentLeague->GetID())
+            {
+                LeagueTable::Standing standing;
+                standing.clubID = user.GetClub()->GetID();
+                standing.wins = compStats.currentWins;
+                standing.draws = compStats.currentDraws;
+                standing.losses = compStats.currentLosses;
+                standing.scored = compStats.currentScored;
+                standing.conceded = compStats.currentConceded;
+
+                currentLeague->GetTable().SetStanding(standing);
+                break;
+            }
+        }
+    }
+}
+
+void LeagueSimulation::SimulateUntil(float seasonProgress)
+{
+    // Note down the strength of every club, so the matches don't have to work out a club's average overall every time it plays
+    MatchEngine::GatherClubStrengths(this->clubStrengths);
+
+    // Note down the users' clubs which play in the users' league, their fixtures there are left for the users to play
+    this->userControlled.assign(this->clubStrengths.size(), 0);
+    for (UserProfile& user : SaveData::GetInstance().GetUsers())
+    {
+        if (user.GetClub()->GetLeague() != SaveData::GetInstance().GetCurrentLeague()->GetID())
+            continue;
+
+        if (user.GetClub()->GetID() >= this->userControlled.size())
+            this->userControlled.resize(user.GetClub()->GetID() + 1, 0);
+
+        this->userControlled[user.GetClub()->GetID()] = 1;
+    }
+
+    // Note down the results the users have recorded since their fixtures were last played, which are the results they've recorded minus
+    // the ones already in the table
+    const League* currentLeague = SaveData::GetInstance().GetCurrentLeague();
+
+    this->unplayedUserResults.clear();
+    for (UserProfile& user : SaveData::GetInstance().GetUsers())
+    {
+        if (user.GetClub()->GetLeague() != currentLeague->GetID())
+            continue;
+
+        for (const UserProfile::CompetitionData& compStats : user.GetCompetitionData())
+        {
+            if (compStats.compID != currentLeague->GetID())
+                continue;
+
+            LeagueTable::Standing results;
+            results.clubID = user.GetClub()->GetID();
+            results.wins = compStats.currentWins;
+            results.draws = compStats.currentDraws;
+            results.losses = compStats.currentLosses;
+            results.scored = compStats.currentScored;
+            results.conceded = compStats.currentConceded;
+
+            if (const LeagueTable::Standing* standing = currentLeague->GetTable().GetStanding(results.clubID))
+            {
+                results.wins = std::max(results.wins - standing->wins, 0);
+                results.draws = std::max(results.draws - standing->draws, 0);
+                results.losses = std::max(results.losses - standing->losses, 0);
+                results.scored = std::max(results.scored - standing->scored, 0);
+                results.conceded = std::max(results.conceded - standing->conceded, 0);
+            }
+
+            this->unplayedUserResults[results.clubID] = results;
+            break;
+        }
+    }
+
+    this->simulatedLeagues.clear();
+    this->targetRounds.clear();
+
+    for (League& league : SaveData::GetInstance().GetLeagueDatabase())
+    {
+        const int totalRounds = LeagueSimulation::GetTotalRounds(league);
+        const int targetRound = std::min((int)std::round(seasonProgress * (float)totalRounds), totalRounds);
+
+        if (targetRound <= league.GetTable().GetRoundsPlayed())
+            continue;
+
+        // The schedules are generated up front, since the cache can't be written to once the leagues are being played in parallel
+        if (this->schedules.count(league.GetClubs().size()) == 0)
+            this->schedules[league.GetClubs().size()] = LeagueSimulation::GenerateSchedule(league.GetClubs().size());
+
+        this->simulatedLeagues.emplace_back(&league);
+        this->targetRounds.emplace_back(targetRound);
+    }
+
+    const uint64_t seasonSeed = this->GetSeasonSeed();
+    Util::ParallelFor(this->simulatedLeagues.size(), [this, seasonSeed](size_t begin, size_t end)
+        {
+            for (size_t index = begin; index < end; index++)
+                this->PlayRounds(*this->simulatedLeagues[index], this->targetRounds[index], seasonSeed);
+        }, 4);
+
+    this->ApplyUserResults();
+}
+
+void LeagueSimulation::StartSeason()
+{
+    for (League& league : SaveData::GetInstance().GetLeagueDatabase())
+        league.GetTable().Reset(league.GetClubs());
+}
+
+void LeagueSimulation::AdvanceSeason()
+{
+    this->SimulateUntil(this->GetSeasonProgress());
+}
+
+void LeagueSimulation::CompleteSeason()
+{
+    this->SimulateUntil(1.0f);
+}
+
+float LeagueSimulation::GetSeasonProgress() const
+{
+    const League* currentLeague = SaveData::GetInstance().GetCurrentLeague();
+
+    // The season is as far along as the user who has played the most league games
+    int userGamesPlayed = 0;
+    for (const UserProfile& user : SaveData::GetInstance().GetUsers())
+    {
+        for (const UserProfile::CompetitionData& compStats : user.GetCompetitionData())
+        {
+            if (compStats.compID == currentLeague->GetID())
+                userGamesPlayed = std::max(userGamesPlayed, compStats.currentWins + compStats.currentDraws + compStats.currentLosses);
+        }
+    }
+
+    const int totalRounds = LeagueSimulation::GetTotalRounds(*currentLeague);
+    return (totalRounds > 0) ? std::min((float)userGamesPlayed / (float)totalRounds, 1.0f) : 0.0f;
+}
+
+int LeagueSimulation::GetTotalRounds(const League& league)
+{
+    const size_t totalClubs = league.GetClubs().size();
+    if (totalClubs < 2)
+        return 0;
+
+    return (int)(totalClubs + (totalClubs % 2) - 1) * 2;
+}
+
+LeagueSimulation& LeagueSimulation::GetInstance()
+{
+    static LeagueSimulation instance;
+    return instance;
+}
@@ -0,0 +1,76 @@
+#ifndef LEAGUE_SIMULATION_H
+#define LEAGUE_SIMULATION_H
+
+#include <serialization/league_group.h>
+#include <simulation/match_engine.h>
+#include <util/random_stream.h>
+
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+class LeagueSimulation
+{
+private:
+	// The rounds of a double round robin, each fixture is a pair of home and away indices into a league's (shuffled) clubs
+	using Schedule = std::vector<std::vector<std::pair<uint8_t, uint8_t>>>;
+
+	std::unordered_map<size_t, Schedule> schedules; // Keyed by the number of clubs in the league
+	std::vector<int> clubStrengths; // Indexed by club ID
+	std::vector<uint8_t> userControlled; // Indexed by club ID
+	std::unordered_map<uint16_t, LeagueTable::Standing> unplayedUserResults; // Keyed by club ID, the users' results not yet given to a fixture
+
+	std::vector<League*> simulatedLeagues;
+	std::vector<int> targetRounds;
+private:
+	LeagueSimulation() = default;
+
+	// Returns a double round robin schedule for a league of the size given, generated using the circle method.
+	// Leagues with an odd number of clubs get a bye each round.
+	static Schedule GenerateSchedule(size_t totalClubs);
+
+	// Returns the seed this season's fixture orders and results are drawn from.
+	uint64_t GetSeasonSeed() const;
+
+	// Takes one game out of the user's unplayed results given, and returns its score from the user's side (the user's goals are the home goals).
+	// The outcomes are spread out over the games, and the goals are shared out so the results add up to the user's recorded totals.
+	static MatchEngine::Result TakeUserResult(LeagueTable::Standing& results);
+
+	// Removes the game with the score given (from the user's side) from the user's unplayed results given.
+	static void RemoveUserResult(LeagueTable::Standing& results, int scored, int conceded);
+
+	// Plays the league's fixtures from the next unplayed round up to the round given.
+	// The users' fixtures take their results from the ones the users recorded, or are simulated if the users haven't got to them yet.
+	// This only touches the league's own table and its own users' results, so it is safe to run for different leagues in parallel.
+	void PlayRounds(League& league, int targetRound, uint64_t seasonSeed);
+
+	// Overwrites the standings of the users' clubs with the results recorded by the users.
+	void ApplyUserResults() const;
+
+	// Plays every league up to the fraction of its season given.
+	void SimulateUntil(float seasonProgress);
+public:
+	LeagueSimulation(const LeagueSimulation& other) = delete;
+	LeagueSimulation(LeagueSimulation&& temp) noexcept = delete;
+	~LeagueSimulation() = default;
+
+	// Clears every league table, ready for a new season.
+	void StartSeason();
+
+	// Plays every league up to the point in the season the users have reached in their league, then slots in the users' results.
+	void AdvanceSeason();
+
+	// Plays the remaining fixtures of every league, then slots in the users' results.
+	void CompleteSeason();
+
+	// Returns how far through the season the users are (from 0 to 1), based on the user who has played the most league games.
+	float GetSeasonProgress() const;
+
+	// Returns the number of rounds of fixtures in a season of the league given.
+	static int GetTotalRounds(const League& league);
+
+	// Returns singleton instance object of this class.
+	static LeagueSimulation& GetInstance();
+};
+
+#endif
@@ -0,0 +1,77 @@
+#include <simulation/match_engine.h>
+#include <serialization/save_data.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    // Clubs with fewer than 11 players don't have an average overall, so they're treated as a weak side
+    constexpr int unknownClubStrength = 55;
+
+    // The average number of goals scored by the home and away sides in a match between evenly matched clubs
+    constexpr float baseHomeGoals = 1.45f, baseAwayGoals = 1.15f;
+
+    // How strongly the difference in average overall between the two clubs swings the expected number of goals
+    constexpr float strengthInfluence = 0.06f;
+
+    constexpr float minExpectedGoals = 0.15f, maxExpectedGoals = 4.5f;
+    constexpr int maxGoals = 10;
+
+    // Returns a number of goals drawn from a Poisson distribution with the mean given (Knuth's method, which is quick for small means).
+    int GenerateGoals(float expectedGoals, RandomStream& stream)
+    {
+        const float threshold = std::exp(-expectedGoals);
+
+        int goals = 0;
+        float product = stream.GenerateRandom<float>(0.0f, 1.0f);
+
+        while (product > threshold && goals < maxGoals)
+        {
+            ++goals;
+            product *= stream.GenerateRandom<float>(0.0f, 1.0f);
+        }
+
+        return goals;
+    }
+}
+
+int MatchEngine::GetClubStrength(const Club& club)
+{
+    const int averageOverall = club.GetAverageOverall();
+    return (averageOverall != -1) ? averageOverall : unknownClubStrength;
+}
+
+void MatchEngine::GatherClubStrengths(std::vector<int>& strengths)
+{
+    strengths.assign(SaveData::GetInstance().GetClubDatabase().size(), unknownClubStrength);
+
+    for (const Club& club : SaveData::GetInstance().GetClubDatabase())
+    {
+        if (club.GetID() >= strengths.size())
+            strengths.resize(club.GetID() + 1, unknownClubStrength);
+
+        strengths[club.GetID()] = MatchEngine::GetClubStrength(club);
+    }
+}
+
+MatchEngine::Result MatchEngine::SimulateMatch(int homeStrength, int awayStrength, RandomStream& stream)
+{
+    const float strengthDifference = (float)(homeStrength - awayStrength);
+    const float homeExpectedGoals = std::clamp(baseHomeGoals * std::exp(strengthInfluence * strengthDifference), minExpectedGoals,
+        maxExpectedGoals);
+    const float awayExpectedGoals = std::clamp(baseAwayGoals * std::exp(-strengthInfluence * strengthDifference), minExpectedGoals,
+        maxExpectedGoals);
+
+    Result result;
+    result.homeGoals = GenerateGoals(homeExpectedGoals, stream);
+    result.awayGoals = GenerateGoals(awayExpectedGoals, stream);
+    return result;
+}
+
+bool MatchEngine::SimulateShootout(int homeStrength, int awayStrength, RandomStream& stream)
+{
+    // Shootouts are mostly luck, the stronger side only gets a slight edge
+    const float homeWinChance = std::clamp(0.5f + (0.01f * (float)(homeStrength - awayStrength)), 0.35f, 0.65f);
+    return stream.GenerateRandom<float>(0.0f, 1.0f) < homeWinChance;
+}
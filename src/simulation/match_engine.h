@@ -0,0 +1,33 @@
+#ifndef MATCH_ENGINE_H
+#define MATCH_ENGINE_H
+
+#include <serialization/club_entity.h>
+#include <util/random_stream.h>
+#include <vector>
+
+class MatchEngine
+{
+public:
+	struct Result
+	{
+		int homeGoals = 0, awayGoals = 0;
+	};
+public:
+	MatchEngine() = delete;
+
+	// Returns the strength used for the club given in simulated matches.
+	static int GetClubStrength(const Club& club);
+
+	// Fills the vector given with the strength of every club in the save's database, indexed by club ID.
+	static void GatherClubStrengths(std::vector<int>& strengths);
+
+	// Simulates a match between two clubs of the strengths given, the goals scored by each side are drawn from a Poisson distribution
+	// whose mean depends on the difference in strength between them.
+	static Result SimulateMatch(int homeStrength, int awayStrength, RandomStream& stream);
+
+	// Simulates a penalty shootout between two clubs of the strengths given.
+	// Returns TRUE if the home club wins the shootout, else FALSE is returned.
+	static bool SimulateShootout(int homeStrength, int awayStrength, RandomStream& stream);
+};
+
+#endif
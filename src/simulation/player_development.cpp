@@ -0,0 +1,127 @@
+#include <simulation/player_development.h>
+#include <serialization/save_data.h>
+#include <util/random_engine.h>
+#include <util/parallel.h>
+
+#include <algorithm>
+
+namespace
+{
+    // Returns the share of the gap between a player's overall and potential which is closed in a season, at the age given.
+    inline float GetGrowthRate(int age)
+    {
+        if (age <= 21)
+            return 0.25f;
+        else if (age <= 24)
+            return 0.18f;
+        else if (age <= 27)
+            return 0.1f;
+        else if (age <= 30)
+            return 0.05f;
+
+        return 0.0f;
+    }
+
+    // Goalkeepers both peak and start declining later than outfielders
+    constexpr int goalkeeperAgeOffset = 2;
+    constexpr int declineStartAge = 31;
+    constexpr int minOverall = 40;
+}
+
+void PlayerDevelopment::GatherColumns()
+{
+    std::vector<Player>& playerDatabase = SaveData::GetInstance().GetPlayerDatabase();
+    const size_t totalPlayers = playerDatabase.size();
+
+    this->players.resize(totalPlayers);
+    this->ages.resize(totalPlayers);
+    this->overalls.resize(totalPlayers);
+    this->potentials.resize(totalPlayers);
+    this->goalkeepers.resize(totalPlayers);
+    this->developedElsewhere.assign(totalPlayers, 0);
+
+    for (size_t index = 0; index < totalPlayers; index++)
+    {
+        Player& player = playerDatabase[index];
+
+        this->players[index] = &player;
+        this->ages[index] = player.GetAge();
+        this->overalls[index] = player.GetOverall();
+        this->potentials[index] = player.GetPotential();
+        this->goalkeepers[index] = (uint8_t)SaveData::GetInstance().GetPositionTraits(player.GetPosition()).goalkeeper;
+    }
+
+    // Flag the players at user clubs, their growth is handled by the 'PlayerGrowthGeneration' state
+    for (UserProfile& user : SaveData::GetInstance().GetUsers())
+    {
+        for (const Player* player : user.GetClub()->GetPlayers())
+            this->developedElsewhere[player - playerDatabase.data()] = 1;
+    }
+}
+
+void PlayerDevelopment::DevelopPlayers(size_t begin, size_t end)
+{
+    for (size_t index = begin; index < end; index++)
+    {
+        const int age = this->ages[index] + 1;
+        const int effectiveAge = age - (this->goalkeepers[index] * goalkeeperAgeOffset);
+
+        int overall = this->overalls[index];
+        int potential = this->potentials[index];
+
+        // Growth closes part of the gap to the player's potential, the fractional part is rounded up or down at random
+        if (!this->developedElsewhere[index] && overall < potential)
+        {
+            const float expectedGrowth = (float)(potential - overall) * GetGrowthRate(effectiveAge);
+            overall = std::min(overall + (int)(expectedGrowth + this->growthRolls[index]), potential);
+        }
+
+        // Decline speeds up the further past their peak the player is, and a declining player can't grow back
+        if (effectiveAge >= declineStartAge)
+        {
+            const float expectedDecline = (float)(effectiveAge - declineStartAge + 1) * 0.6f;
+            overall = std::max(overall - (int)(expectedDecline + this->declineRolls[index]), minOverall);
+            potential = overall;
+        }
+
+        this->ages[index] = age;
+        this->overalls[index] = overall;
+        this->potentials[index] = potential;
+    }
+}
+
+void PlayerDevelopment::SimulateSeason()
+{
+    this->GatherColumns();
+
+    // The random rolls are generated up front in one batch, which keeps the result independent of how the players are split across threads
+    const size_t totalPlayers = this->players.size();
+    RandomStream stream(RandomEngine::GetInstance().DeriveSeed());
+
+    this->growthRolls.resize(totalPlayers);
+    this->declineRolls.resize(totalPlayers);
+    stream.Fill(this->growthRolls.data(), totalPlayers, 0.0f, 1.0f);
+    stream.Fill(this->declineRolls.data(), totalPlayers, 0.0f, 1.5f);
+
+    Util::ParallelFor(totalPlayers, [this](size_t begin, size_t end)
+        {
+            this->DevelopPlayers(begin, end);
+
+            for (size_t index = begin; index < end; index++)
+            {
+                // Retired players are only kept for the transfer history, so they're left as they were when they retired
+                if (this->players[index]->IsRetired())
+                    continue;
+
+                this->players[index]->SetAge(this->ages[index]);
+                this->players[index]->SetOverall(this->overalls[index]);
+                this->players[index]->SetPotential(this->potentials[index]);
+            }
+        }, 1024);
+}
+
+PlayerDevelopment& PlayerDevelopment::GetInstance()
+{
+    static PlayerDevelopment instance;
+    return instance;
+}
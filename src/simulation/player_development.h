@@ -0,0 +1,36 @@
+#ifndef PLAYER_DEVELOPMENT_H
+#define PLAYER_DEVELOPMENT_H
+
+#include <serialization/player_entity.h>
+#include <vector>
+
+class PlayerDevelopment
+{
+private:
+	// The player data is copied into separate columns before the pass, so each step only walks through the data it needs
+	std::vector<Player*> players;
+	std::vector<int> ages, overalls, potentials;
+	std::vector<uint8_t> goalkeepers, developedElsewhere;
+	std::vector<float> growthRolls, declineRolls;
+private:
+	PlayerDevelopment() = default;
+
+	// Copies the data of every player in the save's database into the columns.
+	void GatherColumns();
+
+	// Applies aging, growth and decline to the players in the range given.
+	void DevelopPlayers(size_t begin, size_t end);
+public:
+	PlayerDevelopment(const PlayerDevelopment& other) = delete;
+	PlayerDevelopment(PlayerDevelopment&& temp) noexcept = delete;
+	~PlayerDevelopment() = default;
+
+	// Ages every player in the database by a year, then applies growth to players at AI clubs and decline to every aging player.
+	// Players at user clubs don't receive growth here, as they already grow based on their club's season in the 'PlayerGrowthGeneration' state.
+	void SimulateSeason();
+
+	// Returns singleton instance object of this class.
+	static PlayerDevelopment& GetInstance();
+};
+
+#endif
@@ -0,0 +1,252 @@
+#include <simulation/player_filter.h>
+#include <serialization/save_data.h>
+
+#include <algorithm>
+#include <cctype>
+
+namespace
+{
+    struct FieldName
+    {
+        std::string_view name;
+        PlayerFilter::Field field;
+    };
+
+    // The names each field can be filtered by, with the short names shown in the search screen listed first
+    constexpr FieldName fieldNames[] =
+    {
+        { "pos", PlayerFilter::Field::POSITION }, { "position", PlayerFilter::Field::POSITION },
+        { "age", PlayerFilter::Field::AGE },
+        { "ovr", PlayerFilter::Field::OVERALL }, { "overall", PlayerFilter::Field::OVERALL },
+        { "pot", PlayerFilter::Field::POTENTIAL }, { "potential", PlayerFilter::Field::POTENTIAL },
+        { "value", PlayerFilter::Field::VALUE }, { "val", PlayerFilter::Field::VALUE },
+        { "wage", PlayerFilter::Field::WAGE },
+        { "clause", PlayerFilter::Field::RELEASE_CLAUSE }, { "release", PlayerFilter::Field::RELEASE_CLAUSE },
+        { "expiry", PlayerFilter::Field::EXPIRY_YEAR }, { "contract", PlayerFilter::Field::EXPIRY_YEAR },
+        { "listed", PlayerFilter::Field::TRANSFER_LISTED }
+    };
+
+    // Returns TRUE if the field given holds an amount of money, which can be entered in thousands or millions.
+    inline bool IsMoneyField(PlayerFilter::Field field)
+    {
+        return field == PlayerFilter::Field::VALUE || field == PlayerFilter::Field::WAGE || field == PlayerFilter::Field::RELEASE_CLAUSE;
+    }
+
+    // Returns TRUE if the number given was parsed into the value given, money values may have a fractional part and a "k" or "m" suffix.
+    // The value is capped a step below the largest integer, so a strict comparison can always be turned into an inclusive one.
+    bool ParseNumber(std::string_view text, bool isMoney, int& value)
+    {
+        double number = 0.0, fraction = 0.0, fractionScale = 1.0;
+        bool hasDigits = false, inFraction = false;
+        size_t index = 0;
+
+        for (; index < text.size(); index++)
+        {
+            const char character = text[index];
+            if (std::isdigit((unsigned char)character))
+            {
+                hasDigits = true;
+                if (inFraction)
+                {
+                    fractionScale /= 10.0;
+                    fraction += (character - '0') * fractionScale;
+                }
+                else
+                {
+                    number = std::min((number * 10.0) + (character - '0'), (double)INT_MAX);
+                }
+            }
+            else if (character == '.' && isMoney && !inFraction)
+            {
+                inFraction = true;
+            }
+            else
+            {
+                break;
+            }
+        }
+
+        if (!hasDigits)
+            return false;
+
+        number += fraction;
+        if (isMoney && index < text.size())
+        {
+            const char suffix = (char)std::tolower((unsigned char)text[index]);
+            if (suffix == 'k')
+                number *= 1000.0;
+            else if (suffix == 'm')
+                number *= 1000000.0;
+            else
+                return false;
+
+            index++;
+        }
+
+        if (index != text.size())
+            return false;
+
+        value = (int)std::min(number + 0.5, (double)INT_MAX - 1.0);
+        return true;
+    }
+}
+
+bool PlayerFilter::ParseTerm(std::string_view term)
+{
+    // Split the term into its field, comparison and value
+    const size_t comparisonStart = term.find_first_of(":=<>");
+    if (comparisonStart == std::string_view::npos || comparisonStart == 0)
+    {
+        this->error = "Expected a filter such as 'age<23' but got '" + std::string(term) + "'";
+        return false;
+    }
+
+    std::string fieldName(term.substr(0, comparisonStart));
+    std::transform(fieldName.begin(), fieldName.end(), fieldName.begin(), ::tolower);
+
+    const FieldName* match = std::find_if(std::begin(fieldNames), std::end(fieldNames), [&fieldName](const FieldName& field)
+        { return field.name == fieldName; });
+
+    if (match == std::end(fieldNames))
+    {
+        this->error = "Unknown filter '" + fieldName + "'";
+        return false;
+    }
+
+    const size_t valueStart = (comparisonStart + 1 < term.size() && term[comparisonStart + 1] == '=' &&
+        (term[comparisonStart] == '<' || term[comparisonStart] == '>')) ? comparisonStart + 2 : comparisonStart + 1;
+
+    const std::string_view comparison = term.substr(comparisonStart, valueStart - comparisonStart);
+    const std::string_view valueText = term.substr(valueStart);
+    const bool isEquality = comparison == ":" || comparison == "=";
+
+    if (valueText.empty())
+    {
+        this->error = "Missing value for '" + fieldName + "'";
+        return false;
+    }
+
+    // Work out the inclusive range the term allows
+    int min = INT_MIN, max = INT_MAX;
+    if (match->field == Field::POSITION || match->field == Field::TRANSFER_LISTED)
+    {
+        if (!isEquality)
+        {
+            this->error = "'" + fieldName + "' can only be compared with ':'";
+            return false;
+        }
+
+        std::string value(valueText);
+        std::transform(value.begin(), value.end(), value.begin(), ::toupper);
+
+        if (match->field == Field::POSITION)
+        {
+            const std::vector<SaveData::Position>& positions = SaveData::GetInstance().GetPositionDatabase();
+            const auto position = std::find_if(positions.begin(), positions.end(), [&value](const SaveData::Position& position)
+                { return position.type == value; });
+
+            if (position == positions.end())
+            {
+                this->error = "Unknown position '" + value + "'";
+                return false;
+            }
+
+            min = max = position->id;
+        }
+        else if (value == "YES" || value == "Y" || value == "TRUE" || value == "1")
+        {
+            min = max = 1;
+        }
+        else if (value == "NO" || value == "N" || value == "FALSE" || value == "0")
+        {
+            min = max = 0;
+        }
+        else
+        {
+            this->error = "Expected 'yes' or 'no' for '" + fieldName + "'";
+            return false;
+        }
+    }
+    else
+    {
+        int value = 0;
+        if (!ParseNumber(valueText, IsMoneyField(match->field), value))
+        {
+            this->error = "Invalid value '" + std::string(valueText) + "' for '" + fieldName + "'";
+            return false;
+        }
+
+        if (isEquality)
+            min = max = value;
+        else if (comparison == "<")
+            max = value - 1;
+        else if (comparison == "<=")
+            max = value;
+        else if (comparison == ">")
+            min = value + 1;
+        else
+            min = value;
+    }
+
+    this->AddCondition(match->field, min, max);
+    return true;
+}
+
+void PlayerFilter::AddCondition(Field field, int min, int max)
+{
+    // Terms on the same field narrow down the same condition
+    auto condition = std::find_if(this->conditions.begin(), this->conditions.end(), [field](const Condition& condition)
+        { return condition.field == field; });
+
+    if (condition == this->conditions.end())
+    {
+        this->conditions.push_back({ field, min, max });
+    }
+    else
+    {
+        condition->min = std::max(condition->min, min);
+        condition->max = std::min(condition->max, max);
+    }
+}
+
+bool PlayerFilter::Parse(std::string_view text)
+{
+    this->conditions.clear();
+    this->error.clear();
+
+    size_t termStart = 0;
+    while (termStart < text.size())
+    {
+        if (text[termStart] == ' ')
+        {
+            termStart++;
+            continue;
+        }
+
+        const size_t termEnd = std::min(text.find(' ', termStart), text.size());
+        if (!this->ParseTerm(text.substr(termStart, termEnd - termStart)))
+        {
+            this->conditions.clear();
+            return false;
+        }
+
+        termStart = termEnd;
+    }
+
+    return true;
+}
+
+bool PlayerFilter::IsEmpty() const
+{
+    return this->conditions.empty();
+}
+
+const std::vector<PlayerFilter::Condition>& PlayerFilter::GetConditions() const
+{
+    return this->conditions;
+}
+
+const std::string& PlayerFilter::GetError() const
+{
+    return this->error;
+}
@@ -0,0 +1,62 @@
+#ifndef PLAYER_FILTER_H
+#define PLAYER_FILTER_H
+
+#include <climits>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// A structured search filter such as "pos:ST age<23 ovr>=75 value<20m listed:yes", parsed into the range each player field has to fall in
+class PlayerFilter
+{
+public:
+	enum class Field : uint8_t
+	{
+		POSITION,
+		AGE,
+		OVERALL,
+		POTENTIAL,
+		VALUE,
+		WAGE,
+		RELEASE_CLAUSE,
+		EXPIRY_YEAR,
+		TRANSFER_LISTED
+	};
+
+	// The inclusive range a field has to fall in for a player to pass the filter, the range is empty if the minimum is above the maximum
+	struct Condition
+	{
+		Field field = Field::AGE;
+		int min = INT_MIN, max = INT_MAX;
+	};
+private:
+	std::vector<Condition> conditions;
+	std::string error;
+private:
+	// Parses the term given and narrows down the range of the field it names.
+	// Returns FALSE if the term couldn't be parsed, in which case the error is set.
+	bool ParseTerm(std::string_view term);
+public:
+	PlayerFilter() = default;
+	~PlayerFilter() = default;
+
+	// Parses the filter text given, replacing any conditions parsed before. Terms are separated by spaces, and each is made up of a field,
+	// a comparison (":", "=", "<", "<=", ">" or ">=") and a value. Money values may end in "k" or "m", while the position and listed
+	// fields can only be compared with ":" or "=". Returns FALSE if any of the terms couldn't be parsed.
+	bool Parse(std::string_view text);
+
+	// Narrows down the range of the field given to the inclusive range given, the same as a parsed term on the field would.
+	void AddCondition(Field field, int min, int max);
+
+	// Returns TRUE if the filter has no conditions.
+	bool IsEmpty() const;
+
+	// Returns the conditions of the filter, with at most one condition for each field.
+	const std::vector<Condition>& GetConditions() const;
+
+	// Returns a description of the first term which couldn't be parsed.
+	const std::string& GetError() const;
+};
+
+#endif
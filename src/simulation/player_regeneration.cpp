@@ -0,0 +1,308 @@
+#include <simulation/player_regeneration.h>
+#include <simulation/player_valuation.h>
+#include <serialization/save_data.h>
+#include <util/random_engine.h>
+#include <util/logging_system.h>
+#include <util/parallel.h>
+
+#include <algorithm>
+
+namespace
+{
+    // The chance of a regen being from the nation of the league his club plays in
+    constexpr float localRegenChance = 0.8f;
+
+    // The chance of a regen playing in the same position as the player he replaces, otherwise he plays elsewhere in the same category
+    constexpr float samePositionChance = 0.6f;
+
+    // Goalkeepers retire later than outfielders
+    constexpr int goalkeeperAgeOffset = 2;
+
+    // Player IDs are loaded by counting up from 0 until an ID is missing, so the largest ID can't be used without the count wrapping around
+    constexpr size_t maxPlayers = UINT16_MAX;
+
+    // Returns a random value from the pool given, each value is weighted by the number of times it was added to the pool.
+    // If the pool is empty, then the fallback given is returned.
+    template<typename T> const T& GetWeightedRandom(const std::vector<T>& values, const std::vector<int>& cumulativeCounts, const T& fallback,
+        RandomStream& stream)
+    {
+        if (values.empty() || cumulativeCounts.empty() || cumulativeCounts.back() <= 0)
+            return fallback;
+
+        const int roll = stream.GenerateRandom<int>(0, cumulativeCounts.back() - 1);
+        return values[std::upper_bound(cumulativeCounts.begin(), cumulativeCounts.end(), roll) - cumulativeCounts.begin()];
+    }
+}
+
+void PlayerRegeneration::BuildLookupTables()
+{
+    this->namePools.clear();
+    this->worldNamePool = NamePool();
+
+    std::unordered_map<std::string, int> nationTally, preferredFootTally;
+
+    for (const Player& player : SaveData::GetInstance().GetPlayerDatabase())
+    {
+        if (player.IsRetired())
+            continue;
+
+        // Split the player's name into a first and last name, players known by a single name only contribute a last name
+        const std::string name(player.GetName());
+        NamePool& pool = this->namePools[std::string(player.GetNation())];
+
+        const size_t spaceIndex = name.find(' ');
+        if (spaceIndex != std::string::npos)
+        {
+            pool.firstNames.emplace_back(name.substr(0, spaceIndex));
+            pool.lastNames.emplace_back(name.substr(spaceIndex + 1));
+            this->worldNamePool.firstNames.emplace_back(pool.firstNames.back());
+        }
+        else
+            pool.lastNames.emplace_back(name);
+
+        this->worldNamePool.lastNames.emplace_back(pool.lastNames.back());
+
+        ++nationTally[std::string(player.GetNation())];
+        ++preferredFootTally[std::string(player.GetPreferredFoot())];
+    }
+
+    // Flatten the tallies into weighted pools, sorted so that the pools don't depend on the hash map's iteration order
+    auto flattenTally = [](const std::unordered_map<std::string, int>& tally, std::vector<std::string>& values, std::vector<int>& cumulativeCounts)
+    {
+        std::vector<std::pair<std::string, int>> sortedTally(tally.begin(), tally.end());
+        std::sort(sortedTally.begin(), sortedTally.end());
+
+        values.clear();
+        cumulativeCounts.clear();
+
+        int runningCount = 0;
+        for (const auto& [value, count] : sortedTally)
+        {
+            runningCount += count;
+            values.emplace_back(value);
+            cumulativeCounts.emplace_back(runningCount);
+        }
+    };
+
+    flattenTally(nationTally, this->nations, this->nationCounts);
+    flattenTally(preferredFootTally, this->preferredFeet, this->preferredFootCounts);
+
+    // Note down the nation and strength of every club, since the clubs' squads change while the regens are being generated
+    this->clubNations.assign(SaveData::GetInstance().GetClubDatabase().size(), std::string());
+    this->clubStrengths.assign(SaveData::GetInstance().GetClubDatabase().size(), -1);
+
+    for (Club& club : SaveData::GetInstance().GetClubDatabase())
+    {
+        if (club.GetID() >= this->clubNations.size())
+        {
+            this->clubNations.resize(club.GetID() + 1);
+            this->clubStrengths.resize(club.GetID() + 1, -1);
+        }
+
+        const League* league = SaveData::GetInstance().GetLeague(club.GetLeague());
+        if (league)
+            this->clubNations[club.GetID()] = league->GetNation();
+
+        this->clubStrengths[club.GetID()] = club.GetAverageOverall();
+    }
+
+    // Group the position IDs by their category
+    this->categoryPositions.assign(4, std::vector<uint16_t>());
+    for (const SaveData::Position& position : SaveData::GetInstance().GetPositionDatabase())
+        this->categoryPositions[(size_t)position.category].emplace_back(position.id);
+}
+
+bool PlayerRegeneration::ShouldRetire(const Player& player, float roll) const
+{
+    const int age = player.GetAge() - (SaveData::GetInstance().GetPositionTraits(player.GetPosition()).goalkeeper ? goalkeeperAgeOffset : 0);
+
+    float retirementChance = 0.0f;
+    if (age >= 38)
+        retirementChance = 1.0f;
+    else if (age >= 35)
+        retirementChance = 0.5f;
+    else if (age >= 33)
+        retirementChance = 0.2f;
+
+    // Players who have declined heavily are more likely to call it a day early
+    if (age >= 31 && player.GetOverall() < 60)
+        retirementChance += 0.25f;
+
+    return roll < retirementChance;
+}
+
+Player PlayerRegeneration::GenerateRegen(const Player& retiredPlayer, uint16_t regenID, RandomStream& stream) const
+{
+    const uint16_t clubID = retiredPlayer.GetClub();
+    const std::string retiredNation(retiredPlayer.GetNation()), retiredPreferredFoot(retiredPlayer.GetPreferredFoot());
+
+    // Regens are mostly from the nation of their club's league
+    std::string nation;
+    if (clubID < this->clubNations.size() && !this->clubNations[clubID].empty() && stream.GenerateRandom<float>(0.0f, 1.0f) < localRegenChance)
+        nation = this->clubNations[clubID];
+    else
+        nation = GetWeightedRandom(this->nations, this->nationCounts, retiredNation, stream);
+
+    // Generate a name from the names of the nation's current players, falling back on the names of every player
+    auto poolIterator = this->namePools.find(nation);
+    const NamePool& pool = (poolIterator != this->namePools.end() && !poolIterator->second.firstNames.empty()) ?
+        poolIterator->second : this->worldNamePool;
+
+    // The pools are only empty if every player has retired, in which case the regen takes the retired player's name
+    std::string name = pool.lastNames.empty() ? std::string(retiredPlayer.GetName()) :
+        pool.lastNames[stream.GenerateRandom<int>(0, (int)pool.lastNames.size() - 1)];
+    if (!pool.firstNames.empty())
+        name = pool.firstNames[stream.GenerateRandom<int>(0, (int)pool.firstNames.size() - 1)] + " " + name;
+
+    // The regen plays in the same area of the pitch as the player he replaces, so the club's squad balance is kept
+    uint16_t positionID = retiredPlayer.GetPosition();
+    if (stream.GenerateRandom<float>(0.0f, 1.0f) >= samePositionChance)
+    {
+        const std::vector<uint16_t>& positions = this->categoryPositions[(size_t)SaveData::GetInstance().GetPositionTraits(positionID).category];
+        if (!positions.empty())
+            positionID = positions[stream.GenerateRandom<int>(0, (int)positions.size() - 1)];
+    }
+
+    // Better clubs produce better youth players
+    const int clubStrength = (clubID < this->clubStrengths.size()) ? this->clubStrengths[clubID] : -1;
+    const int potential = std::clamp((clubStrength == -1 ? 60 : clubStrength) + stream.GenerateRandom<int>(-8, 10), 55, 94);
+    const int overall = std::max(potential - stream.GenerateRandom<int>(12, 25), 42);
+    const int age = stream.GenerateRandom<int>(16, 18);
+
+    const std::string& preferredFoot = GetWeightedRandom(this->preferredFeet, this->preferredFootCounts, retiredPreferredFoot, stream);
+    Player regen(name, nation, preferredFoot, regenID, clubID, positionID, age, overall, potential, 0, 0, 0, 
+        SaveData::GetInstance().GetCurrentYear() + 3, false, false);
+
+    // The regen's first contract pays him what the valuation model expects for a player like him
+    const PlayerValuation::Valuation valuation = PlayerValuation::GetInstance().Evaluate(regen);
+    regen.SetValue(valuation.marketValue);
+    regen.SetWage(valuation.expectedWage);
+    return regen;
+}
+
+void PlayerRegeneration::PurgeRetiredPlayerReferences(const std::unordered_set<uint16_t>& retiredIDs) const
+{
+    auto isRetired = [&retiredIDs](uint16_t playerID) { return retiredIDs.count(playerID) > 0; };
+
+    for (Club& club : SaveData::GetInstance().GetClubDatabase())
+    {
+        std::vector<Club::Transfer>& transferInbox = club.GetTransferMessages();
+        transferInbox.erase(std::remove_if(transferInbox.begin(), transferInbox.end(),
+            [&isRetired](const Club::Transfer& transfer) { return isRetired(transfer.playerID); }), transferInbox.end());
+    }
+
+    std::vector<SaveData::NegotiationCooldown>& cooldowns = SaveData::GetInstance().GetNegotiationCooldowns();
+    cooldowns.erase(std::remove_if(cooldowns.begin(), cooldowns.end(),
+        [&isRetired](const SaveData::NegotiationCooldown& cooldown) { return isRetired(cooldown.playerID); }), cooldowns.end());
+}
+
+void PlayerRegeneration::SimulateSeason()
+{
+    std::vector<Player>& playerDatabase = SaveData::GetInstance().GetPlayerDatabase();
+    if (playerDatabase.empty())
+        return;
+
+    this->BuildLookupTables();
+
+    // Decide which players retire, the rolls for every player are generated up front in one batch
+    RandomStream stream(RandomEngine::GetInstance().DeriveSeed());
+    const uint64_t regenSeed = stream.GenerateSeed();
+
+    this->retirementRolls.resize(playerDatabase.size());
+    stream.Fill(this->retirementRolls.data(), this->retirementRolls.size(), 0.0f, 1.0f);
+
+    this->retiredIndices.clear();
+    for (size_t index = 0; index < playerDatabase.size(); index++)
+    {
+        if (!playerDatabase[index].IsRetired() && this->ShouldRetire(playerDatabase[index], this->retirementRolls[index]))
+            this->retiredIndices.emplace_back(index);
+    }
+
+    // Retired players are only kept while the transfer history refers to them, so the regens take over the entries (and IDs) of the
+    // players who retired in earlier seasons and aren't in the history. Nothing else refers to them, as their transfer messages and
+    // negotiation cooldowns were removed when they retired. The rest of the regens are appended with new IDs.
+    std::unordered_set<uint16_t> historyPlayerIDs;
+    for (const SaveData::PastTransfer& transfer : SaveData::GetInstance().GetTransferHistory())
+        historyPlayerIDs.insert(transfer.playerID);
+
+    this->regenIndices.clear();
+    for (size_t index = 0; index < playerDatabase.size(); index++)
+    {
+        if (playerDatabase[index].IsRetired() && historyPlayerIDs.count(playerDatabase[index].GetID()) == 0)
+            this->regenIndices.emplace_back(index);
+    }
+
+    const size_t totalReclaimed = std::min(this->regenIndices.size(), this->retiredIndices.size());
+    this->regenIndices.resize(totalReclaimed);
+
+    // Once the IDs run out, the remaining players carry on for another season
+    const size_t totalFreeIDs = totalReclaimed + (maxPlayers - std::min(playerDatabase.size(), maxPlayers));
+    if (this->retiredIndices.size() > totalFreeIDs)
+    {
+        LogSystem::GetInstance().OutputLog("The player ID space is exhausted, as every retired player left in the database is in the transfer "
+            "history. " + std::to_string(this->retiredIndices.size() - totalFreeIDs) + " players have been kept from retiring.", Severity::WARNING);
+
+        this->retiredIndices.resize(totalFreeIDs);
+    }
+
+    for (size_t index = totalReclaimed; index < this->retiredIndices.size(); index++)
+        this->regenIndices.emplace_back(playerDatabase.size() + (index - totalReclaimed));
+
+    // Generate the regens in parallel, each one draws from a stream tied to its ID so the result doesn't depend on the thread count.
+    // Player IDs match their database index, so a regen's ID is the index of the entry it fills.
+    this->regens.assign(this->retiredIndices.size(), Player());
+
+    Util::ParallelFor(this->retiredIndices.size(), [this, &playerDatabase, regenSeed](size_t begin, size_t end)
+        {
+            for (size_t index = begin; index < end; index++)
+            {
+                const uint16_t regenID = (uint16_t)this->regenIndices[index];
+                RandomStream regenStream(regenSeed, regenID);
+                this->regens[index] = this->GenerateRegen(playerDatabase[this->retiredIndices[index]], regenID, regenStream);
+            }
+        }, 256);
+
+    for (size_t index = 0; index < totalReclaimed; index++)
+        playerDatabase[this->regenIndices[index]] = this->regens[index];
+
+    // The database may be reallocated here, so players are only referred to by index from this point on
+    SaveData::GetInstance().AddPlayers(std::vector<Player>(this->regens.begin() + totalReclaimed, this->regens.end()));
+    SaveData::GetInstance().GetNameIndex().Invalidate();
+
+    // Swap each retired player for his regen in his club's squad, and let the users know about any of their players who retired
+    std::unordered_set<uint16_t> retiredIDs;
+    for (size_t index = 0; index < this->retiredIndices.size(); index++)
+    {
+        Player& retiredPlayer = playerDatabase[this->retiredIndices[index]];
+        Player& regen = playerDatabase[this->regenIndices[index]];
+        retiredIDs.insert(retiredPlayer.GetID());
+
+        Club* club = SaveData::GetInstance().GetClub(retiredPlayer.GetClub());
+        if (club)
+        {
+            club->RemovePlayer(&retiredPlayer);
+            club->AddPlayer(&regen);
+        }
+
+        for (UserProfile& user : SaveData::GetInstance().GetUsers())
+        {
+            if (user.GetClub()->GetID() == retiredPlayer.GetClub())
+            {
+                user.GetClub()->GetGeneralMessages().push_back({ std::string(retiredPlayer.GetName()) + " has retired from football. " +
+                    regen.GetName().data() + " has been promoted from the youth academy to replace him." });
+            }
+        }
+
+        retiredPlayer.SetClub(Player::retiredClubID);
+        retiredPlayer.SetTransferListed(false);
+    }
+
+    // Anything still waiting on the retired players has to go, though the transfer history keeps referring to them
+    this->PurgeRetiredPlayerReferences(retiredIDs);
+}
+
+PlayerRegeneration& PlayerRegeneration::GetInstance()
+{
+    static PlayerRegeneration instance;
+    return instance;
+}
@@ -0,0 +1,63 @@
+#ifndef PLAYER_REGENERATION_H
+#define PLAYER_REGENERATION_H
+
+#include <serialization/player_entity.h>
+#include <util/random_stream.h>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+
+class PlayerRegeneration
+{
+private:
+	struct NamePool
+	{
+		std::vector<std::string> firstNames, lastNames;
+	};
+
+	// Name pools built from the current players of each nation, used to give regens names which fit their nation
+	std::unordered_map<std::string, NamePool> namePools;
+	NamePool worldNamePool;
+
+	// Weighted pools of the nations and preferred feet of the current players, each count is the running total up to that value
+	std::vector<std::string> nations, preferredFeet;
+	std::vector<int> nationCounts, preferredFootCounts;
+
+	std::vector<std::string> clubNations; // Indexed by club ID
+	std::vector<int> clubStrengths; // Indexed by club ID
+	std::vector<std::vector<uint16_t>> categoryPositions; // Position IDs, indexed by position category
+
+	std::vector<size_t> retiredIndices; // The database indices of the players retiring this season
+	std::vector<Player> regens; // Parallel to the retired indices
+	std::vector<size_t> regenIndices; // The database indices the regens are placed at, parallel to the retired indices
+	std::vector<float> retirementRolls;
+private:
+	PlayerRegeneration() = default;
+
+	// Rebuilds the name pools, club nations and position categories from the save's database.
+	void BuildLookupTables();
+
+	// Returns TRUE if the player should retire given the random roll in the range [0, 1), else FALSE is returned.
+	bool ShouldRetire(const Player& player, float roll) const;
+
+	// Returns a newly generated youth player with the ID given, who belongs to the retired player's club.
+	Player GenerateRegen(const Player& retiredPlayer, uint16_t regenID, RandomStream& stream) const;
+
+	// Removes every transfer message and negotiation cooldown which refers to the retired players' IDs.
+	void PurgeRetiredPlayerReferences(const std::unordered_set<uint16_t>& retiredIDs) const;
+public:
+	PlayerRegeneration(const PlayerRegeneration& other) = delete;
+	PlayerRegeneration(PlayerRegeneration&& temp) noexcept = delete;
+	~PlayerRegeneration() = default;
+
+	// Retires old and declining players, replacing each one with a youth player at the same club.
+	// The retired players are kept in the database without a club, so the transfer history still refers to the players it was recorded for.
+	// The regens take over the entries of earlier retirees who aren't in the transfer history, and are otherwise appended with new IDs.
+	void SimulateSeason();
+
+	// Returns singleton instance object of this class.
+	static PlayerRegeneration& GetInstance();
+};
+
+#endif
@@ -0,0 +1,156 @@
+#include <simulation/player_valuation.h>
+#include <serialization/save_data.h>
+#include <util/data_manip.h>
+#include <util/parallel.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    // The market value of a 50 rated player in his prime, every overall point above that multiplies the value by e^0.16 (about 17%)
+    constexpr float baseValue = 200000.0f;
+    constexpr float overallGrowthRate = 0.16f;
+
+    // Weekly wage expected by a player as a share of his market value, along with the lowest wage any player expects
+    constexpr float wageShareOfValue = 0.0022f;
+    constexpr float minExpectedWage = 500.0f;
+
+    // Returns the market value multiplier of the position matching the ID given.
+    inline float GetPositionMultiplier(uint16_t positionID)
+    {
+        const SaveData::PositionTraits& traits = SaveData::GetInstance().GetPositionTraits(positionID);
+        if (traits.goalkeeper)
+            return 0.7f;
+        else if (traits.attackingMinded)
+            return 1.1f;
+
+        return 1.0f;
+    }
+
+    // Computes the market value, expected wage and release clause from the inputs given.
+    // There are no branches in here, so the same code serves both single player queries and the vectorized pass.
+    inline void ComputeValuation(float overall, float potential, float age, float contractYears, float positionMultiplier,
+        float& marketValue, float& expectedWage, float& releaseClause)
+    {
+        // Young players are valued on the growth they have left in them, older players lose value quickly past 29
+        const float growth = std::max(potential - overall, 0.0f);
+        const float youthMultiplier = 1.0f + (growth * 0.04f * std::clamp((27.0f - age) / 10.0f, 0.0f, 1.0f));
+        const float ageMultiplier = std::clamp(1.0f - (0.15f * (age - 29.0f)), 0.2f, 1.0f);
+
+        // Players with less than two years left on their contract can be bought on the cheap
+        const float contractMultiplier = std::clamp(0.5f + (0.25f * contractYears), 0.5f, 1.0f);
+
+        marketValue = baseValue * std::exp(overallGrowthRate * (overall - 50.0f)) * youthMultiplier * ageMultiplier * contractMultiplier * 
+            positionMultiplier;
+
+        expectedWage = std::max(marketValue * wageShareOfValue, minExpectedWage);
+        releaseClause = marketValue * (1.6f + (0.02f * growth));
+    }
+
+    // Returns the valuation given, rounded the same way as every other cash amount in the game.
+    inline PlayerValuation::Valuation RoundValuation(float marketValue, float expectedWage, float releaseClause)
+    {
+        PlayerValuation::Valuation valuation;
+        valuation.marketValue = Util::GetTruncatedSFInteger((int)marketValue, 3);
+        valuation.expectedWage = Util::GetTruncatedSFInteger((int)expectedWage, 2);
+        valuation.releaseClause = Util::GetTruncatedSFInteger((int)releaseClause, 3);
+
+        return valuation;
+    }
+}
+
+void PlayerValuation::GatherColumns()
+{
+    std::vector<Player>& playerDatabase = SaveData::GetInstance().GetPlayerDatabase();
+    const size_t totalPlayers = playerDatabase.size();
+    const int currentYear = SaveData::GetInstance().GetCurrentYear();
+
+    this->players.resize(totalPlayers);
+    this->overalls.resize(totalPlayers);
+    this->potentials.resize(totalPlayers);
+    this->ages.resize(totalPlayers);
+    this->contractYears.resize(totalPlayers);
+    this->positionMultipliers.resize(totalPlayers);
+    this->marketValues.resize(totalPlayers);
+    this->expectedWages.resize(totalPlayers);
+    this->releaseClauses.resize(totalPlayers);
+
+    for (size_t index = 0; index < totalPlayers; index++)
+    {
+        const Player& player = playerDatabase[index];
+
+        this->players[index] = &playerDatabase[index];
+        this->overalls[index] = (float)player.GetOverall();
+        this->potentials[index] = (float)player.GetPotential();
+        this->ages[index] = (float)player.GetAge();
+        this->contractYears[index] = (float)(player.GetExpiryYear() - currentYear);
+        this->positionMultipliers[index] = GetPositionMultiplier(player.GetPosition());
+    }
+}
+
+void PlayerValuation::EvaluateRange(size_t begin, size_t end)
+{
+    for (size_t index = begin; index < end; index++)
+    {
+        ComputeValuation(this->overalls[index], this->potentials[index], this->ages[index], this->contractYears[index], 
+            this->positionMultipliers[index], this->marketValues[index], this->expectedWages[index], this->releaseClauses[index]);
+    }
+}
+
+void PlayerValuation::Recalculate()
+{
+    this->GatherColumns();
+
+    const size_t totalPlayers = this->players.size();
+    Util::ParallelFor(totalPlayers, [this](size_t begin, size_t end) { this->EvaluateRange(begin, end); }, 2048);
+
+    // Write the results back into the players and the cache
+    this->valuations.assign(totalPlayers, Valuation());
+    for (size_t index = 0; index < totalPlayers; index++)
+    {
+        const Valuation valuation = RoundValuation(this->marketValues[index], this->expectedWages[index], this->releaseClauses[index]);
+        this->players[index]->SetValue(valuation.marketValue);
+
+        if (this->players[index]->GetID() >= this->valuations.size())
+            this->valuations.resize(this->players[index]->GetID() + 1);
+
+        this->valuations[this->players[index]->GetID()] = valuation;
+    }
+}
+
+PlayerValuation::Valuation PlayerValuation::Evaluate(const Player& player) const
+{
+    float marketValue = 0.0f, expectedWage = 0.0f, releaseClause = 0.0f;
+    ComputeValuation((float)player.GetOverall(), (float)player.GetPotential(), (float)player.GetAge(), 
+        (float)(player.GetExpiryYear() - SaveData::GetInstance().GetCurrentYear()), GetPositionMultiplier(player.GetPosition()), 
+        marketValue, expectedWage, releaseClause);
+
+    return RoundValuation(marketValue, expectedWage, releaseClause);
+}
+
+void PlayerValuation::Revalue(Player& player)
+{
+    const Valuation valuation = this->Evaluate(player);
+    player.SetValue(valuation.marketValue);
+
+    if (player.GetID() >= this->valuations.size())
+        this->valuations.resize(player.GetID() + 1);
+
+    this->valuations[player.GetID()] = valuation;
+}
+
+PlayerValuation::Valuation PlayerValuation::GetValuation(uint16_t playerID) const
+{
+    if (playerID < this->valuations.size() && this->valuations[playerID].marketValue > 0)
+        return this->valuations[playerID];
+
+    const Player* player = SaveData::GetInstance().GetPlayer(playerID);
+    return player ? this->Evaluate(*player) : Valuation();
+}
+
+PlayerValuation& PlayerValuation::GetInstance()
+{
+    static PlayerValuation instance;
+    return instance;
+}
@@ -0,0 +1,53 @@
+#ifndef PLAYER_VALUATION_H
+#define PLAYER_VALUATION_H
+
+#include <serialization/player_entity.h>
+#include <vector>
+
+class PlayerValuation
+{
+public:
+	struct Valuation
+	{
+		int marketValue = 0, expectedWage = 0, releaseClause = 0;
+	};
+private:
+	// The model's inputs and outputs are kept in separate columns, so the pass over them is a plain loop of arithmetic which the compiler 
+	// can vectorize
+	std::vector<Player*> players;
+	std::vector<float> overalls, potentials, ages, contractYears, positionMultipliers;
+	std::vector<float> marketValues, expectedWages, releaseClauses;
+
+	std::vector<Valuation> valuations; // Indexed by player ID
+private:
+	PlayerValuation() = default;
+
+	// Copies the model inputs of every player in the save's database into the columns.
+	void GatherColumns();
+
+	// Runs the valuation model over the players in the range given.
+	void EvaluateRange(size_t begin, size_t end);
+public:
+	PlayerValuation(const PlayerValuation& other) = delete;
+	PlayerValuation(PlayerValuation&& temp) noexcept = delete;
+	~PlayerValuation() = default;
+
+	// Recalculates the valuation of every player in the database, and updates every player's market value.
+	void Recalculate();
+
+	// Returns the valuation of the player given, computed from the player's current data.
+	Valuation Evaluate(const Player& player) const;
+
+	// Revalues the player given from the player's current data, updating the player's market value and the cached valuation.
+	// This should be called whenever a single player's data changes between recalculations.
+	void Revalue(Player& player);
+
+	// Returns the valuation of the player matching the ID given, as of the last recalculation.
+	// If the player wasn't valued in the last recalculation, then the valuation is computed from the player's current data.
+	Valuation GetValuation(uint16_t playerID) const;
+
+	// Returns singleton instance object of this class.
+	static PlayerValuation& GetInstance();
+};
+
+#endif
@@ -0,0 +1,308 @@
+#include <simulation/scouting_engine.h>
+#include <serialization/save_data.h>
+#include <util/parallel.h>
+
+#include <algorithm>
+
+namespace
+{
+    // The number of players scored by each parallel chunk
+    constexpr size_t scoutingChunkSize = 4096;
+
+    // The score a player loses for playing in a position compatible with the one scouted for, rather than the position itself
+    constexpr float compatiblePositionPenalty = 3.0f;
+
+    // A player scored below this hasn't passed the profile's filters
+    constexpr float excludedScore = -1.0f;
+
+    // The most rows sampled from the columns to estimate the share of players passing a filter test
+    constexpr size_t filterSampleSize = 1024;
+
+    struct Candidate
+    {
+        float score;
+        int value;
+        size_t index;
+    };
+
+    // Returns TRUE if the value given lies within the range of the test given. The range check is done with a single unsigned comparison,
+    // as any value below the minimum wraps around to above the span.
+    inline bool PassesTest(const ScoutingEngine::CompiledFilter::Test& test, int value)
+    {
+        return (uint32_t)value - (uint32_t)test.min <= test.span;
+    }
+
+    // Returns TRUE if the player at the database index given passes every test of the filter given, the position isn't checked.
+    inline bool PassesTests(const ScoutingEngine::CompiledFilter& filter, size_t index)
+    {
+        for (const ScoutingEngine::CompiledFilter::Test& test : filter.tests)
+        {
+            if (!PassesTest(test, test.column[index]))
+                return false;
+        }
+
+        return true;
+    }
+
+    // Returns TRUE if the first candidate is a better fit than the second, cheaper players are preferred when the scores are tied.
+    inline bool IsBetterCandidate(const Candidate& first, const Candidate& second)
+    {
+        if (first.score != second.score)
+            return first.score > second.score;
+
+        if (first.value != second.value)
+            return first.value < second.value;
+
+        return first.index < second.index;
+    }
+}
+
+void ScoutingEngine::GatherColumns()
+{
+    std::vector<Player>& playerDatabase = SaveData::GetInstance().GetPlayerDatabase();
+    const size_t totalPlayers = playerDatabase.size();
+
+    this->players.resize(totalPlayers);
+    this->positions.resize(totalPlayers);
+    this->clubs.resize(totalPlayers);
+    this->ages.resize(totalPlayers);
+    this->overalls.resize(totalPlayers);
+    this->potentials.resize(totalPlayers);
+    this->values.resize(totalPlayers);
+    this->wages.resize(totalPlayers);
+    this->releaseClauses.resize(totalPlayers);
+    this->expiryYears.resize(totalPlayers);
+    this->transferListed.resize(totalPlayers);
+
+    for (size_t index = 0; index < totalPlayers; index++)
+    {
+        Player& player = playerDatabase[index];
+
+        this->players[index] = &player;
+        this->positions[index] = player.IsRetired() ? UINT16_MAX : player.GetPosition(); // Retired players are left out of every position
+        this->clubs[index] = player.GetClub();
+        this->ages[index] = player.GetAge();
+        this->overalls[index] = player.GetOverall();
+        this->potentials[index] = player.GetPotential();
+        this->values[index] = player.GetValue();
+        this->wages[index] = player.GetWage();
+        this->releaseClauses[index] = player.GetReleaseClause();
+        this->expiryYears[index] = player.GetExpiryYear();
+        this->transferListed[index] = player.GetTransferListed() ? 1 : 0;
+    }
+
+    // Group the players by position with a counting sort, which keeps each position's players in ascending order
+    const size_t totalPositions = SaveData::GetInstance().GetPositionDatabase().size();
+    this->positionOffsets.assign(totalPositions + 1, 0);
+
+    for (uint16_t positionID : this->positions)
+    {
+        if (positionID < totalPositions)
+            this->positionOffsets[positionID + 1]++;
+    }
+
+    for (size_t positionID = 0; positionID < totalPositions; positionID++)
+        this->positionOffsets[positionID + 1] += this->positionOffsets[positionID];
+
+    std::vector<uint32_t> nextSlots(this->positionOffsets.begin(), this->positionOffsets.end() - 1);
+    this->playersByPosition.resize(this->positionOffsets.back());
+
+    for (size_t index = 0; index < totalPlayers; index++)
+    {
+        if (this->positions[index] < totalPositions)
+            this->playersByPosition[nextSlots[this->positions[index]]++] = (uint32_t)index;
+    }
+}
+
+const std::vector<int>* ScoutingEngine::GetColumn(PlayerFilter::Field field) const
+{
+    switch (field)
+    {
+    case PlayerFilter::Field::AGE:
+        return &this->ages;
+    case PlayerFilter::Field::OVERALL:
+        return &this->overalls;
+    case PlayerFilter::Field::POTENTIAL:
+        return &this->potentials;
+    case PlayerFilter::Field::VALUE:
+        return &this->values;
+    case PlayerFilter::Field::WAGE:
+        return &this->wages;
+    case PlayerFilter::Field::RELEASE_CLAUSE:
+        return &this->releaseClauses;
+    case PlayerFilter::Field::EXPIRY_YEAR:
+        return &this->expiryYears;
+    case PlayerFilter::Field::TRANSFER_LISTED:
+        return &this->transferListed;
+    default:
+        return nullptr;
+    }
+}
+
+ScoutingEngine::CompiledFilter ScoutingEngine::CompileFilter(const PlayerFilter& filter) const
+{
+    CompiledFilter compiledFilter;
+    compiledFilter.positions = this->positions.data();
+
+    const size_t totalPlayers = this->players.size();
+    const size_t sampleStep = std::max(totalPlayers / filterSampleSize, (size_t)1);
+
+    for (const PlayerFilter::Condition& condition : filter.GetConditions())
+    {
+        if (condition.min > condition.max)
+        {
+            compiledFilter.matchesNothing = true;
+            continue;
+        }
+
+        // The position is an exact match, so it's answered by the position index rather than being tested
+        if (condition.field == PlayerFilter::Field::POSITION)
+        {
+            compiledFilter.positionID = condition.min;
+            if (condition.min < 0 || (size_t)condition.min + 1 >= this->positionOffsets.size())
+                compiledFilter.matchesNothing = true;
+
+            continue;
+        }
+
+        const std::vector<int>* column = this->GetColumn(condition.field);
+        if (!column)
+            continue;
+
+        CompiledFilter::Test test;
+        test.column = column->data();
+        test.min = condition.min;
+        test.span = (uint32_t)condition.max - (uint32_t)condition.min;
+
+        // Estimate how selective the test is from an evenly spread sample of the column
+        size_t totalSampled = 0, totalPassed = 0;
+        for (size_t index = 0; index < totalPlayers; index += sampleStep)
+        {
+            totalSampled++;
+            if (PassesTest(test, (*column)[index]))
+                totalPassed++;
+        }
+
+        test.passRate = (totalSampled > 0) ? (float)totalPassed / (float)totalSampled : 1.0f;
+        compiledFilter.tests.emplace_back(test);
+    }
+
+    std::stable_sort(compiledFilter.tests.begin(), compiledFilter.tests.end(), [](const CompiledFilter::Test& first, const CompiledFilter::Test& second)
+        { return first.passRate < second.passRate; });
+
+    return compiledFilter;
+}
+
+bool ScoutingEngine::CompiledFilter::Matches(size_t index) const
+{
+    if (this->matchesNothing || (this->positionID >= 0 && this->positions[index] != this->positionID))
+        return false;
+
+    return PassesTests(*this, index);
+}
+
+std::vector<uint32_t> ScoutingEngine::GetPlayersInPosition(uint16_t positionID) const
+{
+    if ((size_t)positionID + 1 >= this->positionOffsets.size())
+        return {};
+
+    return std::vector<uint32_t>(this->playersByPosition.begin() + this->positionOffsets[positionID],
+        this->playersByPosition.begin() + this->positionOffsets[positionID + 1]);
+}
+
+std::vector<ScoutingEngine::Recommendation> ScoutingEngine::Recommend(const Profile& profile, size_t count) const
+{
+    std::vector<Recommendation> recommendations;
+    if (count == 0 || this->players.empty() || (profile.filter && profile.filter->matchesNothing))
+        return recommendations;
+
+    // Work out the score each position loses up front, so scoring a player is a single lookup rather than a check of the position traits
+    const size_t totalPositions = SaveData::GetInstance().GetPositionDatabase().size();
+    std::vector<float> positionPenalties(totalPositions, (profile.positionID < 0) ? 0.0f : excludedScore);
+
+    if (profile.positionID >= 0 && (size_t)profile.positionID < totalPositions)
+    {
+        const SaveData::PositionTraits& traits = SaveData::GetInstance().GetPositionTraits((uint16_t)profile.positionID);
+        for (uint16_t positionID = 0; positionID < (uint16_t)totalPositions; positionID++)
+        {
+            if (positionID == profile.positionID)
+                positionPenalties[positionID] = 0.0f;
+            else if (profile.includeCompatiblePositions && traits.IsCompatibleWith(positionID))
+                positionPenalties[positionID] = compatiblePositionPenalty;
+        }
+    }
+
+    // If the filter names a position, then only the players in that position are looked at through the position index
+    const uint32_t* scannedPlayers = nullptr;
+    size_t totalScanned = this->players.size();
+
+    if (profile.filter && profile.filter->positionID >= 0)
+    {
+        scannedPlayers = this->playersByPosition.data() + this->positionOffsets[profile.filter->positionID];
+        totalScanned = this->positionOffsets[profile.filter->positionID + 1] - this->positionOffsets[profile.filter->positionID];
+    }
+
+    // Every chunk keeps its best candidates in a heap with the worst of them on top, so it can be swapped out for anyone better
+    const size_t totalChunks = (totalScanned + scoutingChunkSize - 1) / scoutingChunkSize;
+    std::vector<std::vector<Candidate>> chunkCandidates(totalChunks);
+
+    Util::ParallelFor(totalChunks, [&](size_t beginChunk, size_t endChunk)
+        {
+            for (size_t chunk = beginChunk; chunk < endChunk; chunk++)
+            {
+                std::vector<Candidate>& heap = chunkCandidates[chunk];
+                heap.reserve(count);
+
+                const size_t end = std::min((chunk + 1) * scoutingChunkSize, totalScanned);
+                for (size_t slot = chunk * scoutingChunkSize; slot < end; slot++)
+                {
+                    const size_t index = scannedPlayers ? scannedPlayers[slot] : slot;
+
+                    const float positionPenalty = (this->positions[index] < totalPositions) ? positionPenalties[this->positions[index]] : excludedScore;
+                    if (positionPenalty < 0.0f || this->ages[index] < profile.minAge || this->ages[index] > profile.maxAge ||
+                        this->potentials[index] < profile.minPotential || this->values[index] > profile.maxValue ||
+                        this->wages[index] > profile.maxWage || (int)this->clubs[index] == profile.excludedClubID ||
+                        (profile.filter && !PassesTests(*profile.filter, index)))
+                    {
+                        continue;
+                    }
+
+                    // Current ability counts for more than potential, as the player is being bought to play
+                    const Candidate candidate = { (0.6f * (float)this->overalls[index]) + (0.4f * (float)this->potentials[index]) - positionPenalty,
+                        this->values[index], index };
+
+                    if (heap.size() < count)
+                    {
+                        heap.emplace_back(candidate);
+                        std::push_heap(heap.begin(), heap.end(), IsBetterCandidate);
+                    }
+                    else if (IsBetterCandidate(candidate, heap.front()))
+                    {
+                        std::pop_heap(heap.begin(), heap.end(), IsBetterCandidate);
+                        heap.back() = candidate;
+                        std::push_heap(heap.begin(), heap.end(), IsBetterCandidate);
+                    }
+                }
+            }
+        }, 1);
+
+    // Merge the chunks' candidates and keep the best of them overall
+    std::vector<Candidate> candidates;
+    for (const std::vector<Candidate>& heap : chunkCandidates)
+        candidates.insert(candidates.end(), heap.begin(), heap.end());
+
+    const size_t totalRecommended = std::min(count, candidates.size());
+    std::partial_sort(candidates.begin(), candidates.begin() + totalRecommended, candidates.end(), IsBetterCandidate);
+
+    recommendations.reserve(totalRecommended);
+    for (size_t index = 0; index < totalRecommended; index++)
+        recommendations.push_back({ this->players[candidates[index].index], candidates[index].score });
+
+    return recommendations;
+}
+
+ScoutingEngine& ScoutingEngine::GetInstance()
+{
+    static ScoutingEngine instance;
+    return instance;
+}
@@ -0,0 +1,88 @@
+#ifndef SCOUTING_ENGINE_H
+#define SCOUTING_ENGINE_H
+
+#include <serialization/player_entity.h>
+#include <simulation/player_filter.h>
+#include <climits>
+#include <vector>
+
+class ScoutingEngine
+{
+public:
+	// A player filter compiled against the columns, this is only valid until the columns are gathered again
+	struct CompiledFilter
+	{
+		// A range test on one of the columns, a value passes if it lies within [min, min + span]
+		struct Test
+		{
+			const int* column = nullptr;
+			int min = 0;
+			uint32_t span = 0;
+			float passRate = 1.0f; // The estimated share of players which pass the test
+		};
+
+		std::vector<Test> tests; // Ordered from the test the fewest players pass, so most players are rejected by the first test run
+		const uint16_t* positions = nullptr;
+		int positionID = -1; // The position the players have to play in, which is looked up through the position index where possible
+		bool matchesNothing = false;
+
+		// Returns TRUE if the player at the database index given passes the filter.
+		bool Matches(size_t index) const;
+	};
+
+	// The kind of player being scouted for, a negative position ID means any position is looked at
+	struct Profile
+	{
+		int positionID = -1;
+		bool includeCompatiblePositions = true;
+		int minAge = 0, maxAge = INT_MAX, minPotential = 0;
+		int maxValue = INT_MAX, maxWage = INT_MAX;
+		int excludedClubID = -1; // The players of this club are left out, this is usually the user's own club
+		const CompiledFilter* filter = nullptr; // An optional filter the players also have to pass
+	};
+
+	struct Recommendation
+	{
+		Player* player = nullptr;
+		float score = 0.0f;
+	};
+private:
+	// The inputs of the scoring are kept in separate columns, so a search only has to stream through the fields it actually looks at
+	std::vector<Player*> players;
+	std::vector<uint16_t> positions, clubs;
+	std::vector<int> ages, overalls, potentials, values, wages, releaseClauses, expiryYears;
+	std::vector<int> transferListed; // Kept as integers so it can be tested like the other columns
+
+	// The database indices of the players grouped by position, the players of a position lie between its offset and the next one
+	std::vector<uint32_t> playersByPosition, positionOffsets;
+private:
+	// Returns the column holding the field given, or nullptr if the field isn't kept in an integer column.
+	const std::vector<int>* GetColumn(PlayerFilter::Field field) const;
+private:
+	ScoutingEngine() = default;
+public:
+	ScoutingEngine(const ScoutingEngine& other) = delete;
+	ScoutingEngine(ScoutingEngine&& temp) noexcept = delete;
+	~ScoutingEngine() = default;
+
+	// Copies the scouting inputs of every player in the save's database into the columns.
+	// This has to be called again for the searches to see any changes made to the players since.
+	void GatherColumns();
+
+	// Compiles the filter given into range tests over the columns. The share of players passing each test is estimated from a sample of
+	// the columns, and the tests are ordered so the most selective ones are run first.
+	CompiledFilter CompileFilter(const PlayerFilter& filter) const;
+
+	// Returns the database indices, in ascending order, of the players who play in the position given.
+	std::vector<uint32_t> GetPlayersInPosition(uint16_t positionID) const;
+
+	// Returns the players which best fit the profile given, ordered from the best fit down, with at most the count given returned.
+	// The players are scored in parallel chunks, with each chunk keeping its best players in a heap bounded by the count given. If the
+	// profile's filter names a position, then only the players in that position are looked at.
+	std::vector<Recommendation> Recommend(const Profile& profile, size_t count) const;
+
+	// Returns singleton instance object of this class.
+	static ScoutingEngine& GetInstance();
+};
+
+#endif
@@ -0,0 +1,209 @@
+#include <simulation/squad_optimizer.h>
+#include <serialization/save_data.h>
+
+#include <algorithm>
+#include <climits>
+#include <string_view>
+
+namespace
+{
+    // The positions of the 4-3-3 formation every club lines up in
+    constexpr std::array<std::string_view, SquadOptimizer::lineupSize> formation = {
+        "GK", "LB", "CB", "CB", "RB", "CDM", "CM", "CAM", "LW", "ST", "RW"
+    };
+
+    // The overall a player loses when playing out of position
+    constexpr int compatiblePenalty = 3, sameCategoryPenalty = 8, otherCategoryPenalty = 15, goalkeeperPenalty = 40;
+
+    // Returns the position IDs of the formation's slots, or FALSE if the formation's positions aren't all loaded.
+    bool GetFormationPositions(std::array<uint16_t, SquadOptimizer::lineupSize>& positionIDs)
+    {
+        const std::vector<SaveData::Position>& positions = SaveData::GetInstance().GetPositionDatabase();
+        for (size_t slot = 0; slot < formation.size(); slot++)
+        {
+            auto position = std::find_if(positions.begin(), positions.end(),
+                [&](const SaveData::Position& position) { return position.type == formation[slot]; });
+
+            if (position == positions.end())
+                return false;
+
+            positionIDs[slot] = position->id;
+        }
+
+        return true;
+    }
+}
+
+int SquadOptimizer::Lineup::GetAverageRating() const
+{
+    return this->complete ? this->totalRating / (int)lineupSize : -1;
+}
+
+const SquadOptimizer::Slot* SquadOptimizer::Lineup::GetStartingSlot(const Player& player) const
+{
+    for (const Slot& slot : this->slots)
+    {
+        if (slot.starter && slot.starter->GetID() == player.GetID())
+            return &slot;
+    }
+
+    return nullptr;
+}
+
+int SquadOptimizer::GetSlotRating(const Player& player, uint16_t positionID)
+{
+    const SaveData::PositionTraits& playerTraits = SaveData::GetInstance().GetPositionTraits(player.GetPosition());
+    const SaveData::PositionTraits& slotTraits = SaveData::GetInstance().GetPositionTraits(positionID);
+
+    int penalty = 0;
+    if (player.GetPosition() == positionID)
+        penalty = 0;
+    else if (playerTraits.goalkeeper != slotTraits.goalkeeper)
+        penalty = goalkeeperPenalty;
+    else if (playerTraits.IsCompatibleWith(positionID))
+        penalty = compatiblePenalty;
+    else if (playerTraits.category == slotTraits.category)
+        penalty = sameCategoryPenalty;
+    else
+        penalty = otherCategoryPenalty;
+
+    return std::max(player.GetOverall() - penalty, 1);
+}
+
+SquadOptimizer::Lineup SquadOptimizer::GetBestLineup(const std::vector<Player*>& players)
+{
+    Lineup lineup;
+
+    std::array<uint16_t, lineupSize> positionIDs;
+    if (players.size() < lineupSize || !GetFormationPositions(positionIDs))
+        return lineup;
+
+    // Work out the rating of every player in every slot, the cost of an assignment is how far the rating falls short of the best possible
+    constexpr int maxRating = 100;
+    const size_t totalPlayers = players.size();
+
+    std::vector<int> ratings(lineupSize * totalPlayers);
+    for (size_t slot = 0; slot < lineupSize; slot++)
+    {
+        for (size_t player = 0; player < totalPlayers; player++)
+            ratings[(slot * totalPlayers) + player] = SquadOptimizer::GetSlotRating(*players[player], positionIDs[slot]);
+    }
+
+    // Solve the assignment with the Hungarian algorithm. Slots are the rows and players are the columns, both are 1-indexed so that
+    // column 0 can stand for the slot currently being assigned.
+    std::array<int, lineupSize + 1> slotPotentials = {};
+    std::vector<int> playerPotentials(totalPlayers + 1, 0), minSlack(totalPlayers + 1);
+    std::vector<size_t> assignedSlot(totalPlayers + 1, 0), previousPlayer(totalPlayers + 1, 0);
+    std::vector<bool> visited(totalPlayers + 1);
+
+    for (size_t slot = 1; slot <= lineupSize; slot++)
+    {
+        assignedSlot[0] = slot;
+        size_t currentPlayer = 0;
+
+        std::fill(minSlack.begin(), minSlack.end(), INT_MAX);
+        std::fill(visited.begin(), visited.end(), false);
+
+        // Grow the alternating tree until it reaches a player who hasn't been assigned a slot yet
+        do
+        {
+            visited[currentPlayer] = true;
+            const size_t currentSlot = assignedSlot[currentPlayer];
+
+            int delta = INT_MAX;
+            size_t nextPlayer = 0;
+
+            for (size_t player = 1; player <= totalPlayers; player++)
+            {
+                if (visited[player])
+                    continue;
+
+                const int cost = maxRating - ratings[((currentSlot - 1) * totalPlayers) + (player - 1)];
+                const int slack = cost - slotPotentials[currentSlot] - playerPotentials[player];
+
+                if (slack < minSlack[player])
+                {
+                    minSlack[player] = slack;
+                    previousPlayer[player] = currentPlayer;
+                }
+
+                if (minSlack[player] < delta)
+                {
+                    delta = minSlack[player];
+                    nextPlayer = player;
+                }
+            }
+
+            for (size_t player = 0; player <= totalPlayers; player++)
+            {
+                if (visited[player])
+                {
+                    slotPotentials[assignedSlot[player]] += delta;
+                    playerPotentials[player] -= delta;
+                }
+                else
+                {
+                    minSlack[player] -= delta;
+                }
+            }
+
+            currentPlayer = nextPlayer;
+        } while (assignedSlot[currentPlayer] != 0);
+
+        // Flip the assignments along the augmenting path
+        do
+        {
+            const size_t player = previousPlayer[currentPlayer];
+            assignedSlot[currentPlayer] = assignedSlot[player];
+            currentPlayer = player;
+        } while (currentPlayer != 0);
+    }
+
+    // Fill in the starters, then pick out the best player left on the bench for every slot
+    for (size_t slot = 0; slot < lineupSize; slot++)
+        lineup.slots[slot].positionID = positionIDs[slot];
+
+    for (size_t player = 1; player <= totalPlayers; player++)
+    {
+        if (assignedSlot[player] == 0)
+            continue;
+
+        Slot& slot = lineup.slots[assignedSlot[player] - 1];
+        slot.starter = players[player - 1];
+        slot.starterRating = ratings[((assignedSlot[player] - 1) * totalPlayers) + (player - 1)];
+        lineup.totalRating += slot.starterRating;
+    }
+
+    for (size_t slot = 0; slot < lineupSize; slot++)
+    {
+        for (size_t player = 0; player < totalPlayers; player++)
+        {
+            const int rating = ratings[(slot * totalPlayers) + player];
+            if (assignedSlot[player + 1] == 0 && rating > lineup.slots[slot].backupRating)
+            {
+                lineup.slots[slot].backup = players[player];
+                lineup.slots[slot].backupRating = rating;
+            }
+        }
+    }
+
+    lineup.complete = true;
+    return lineup;
+}
+
+SquadOptimizer::Lineup SquadOptimizer::GetBestLineup(const Club& club)
+{
+    return SquadOptimizer::GetBestLineup(club.GetPlayers());
+}
+
+int SquadOptimizer::GetLineupGain(const Club& club, const Lineup& currentLineup, const Player& player)
+{
+    std::vector<Player*> players = club.GetPlayers();
+    players.emplace_back(const_cast<Player*>(&player));
+
+    const Lineup newLineup = SquadOptimizer::GetBestLineup(players);
+    if (!newLineup.complete)
+        return 0;
+
+    return newLineup.totalRating - currentLineup.totalRating;
+}
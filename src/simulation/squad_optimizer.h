@@ -0,0 +1,53 @@
+#ifndef SQUAD_OPTIMIZER_H
+#define SQUAD_OPTIMIZER_H
+
+#include <serialization/club_entity.h>
+#include <array>
+#include <vector>
+
+class SquadOptimizer
+{
+public:
+	static constexpr size_t lineupSize = 11;
+
+	// A position in the formation, along with the player starting in it and the best player on the bench to cover it
+	struct Slot
+	{
+		uint16_t positionID = 0;
+		const Player* starter = nullptr;
+		const Player* backup = nullptr;
+		int starterRating = 0, backupRating = 0;
+	};
+
+	struct Lineup
+	{
+		std::array<Slot, lineupSize> slots;
+		int totalRating = 0;
+		bool complete = false; // Set as FALSE if there weren't enough players to fill every slot
+
+		// Returns the average rating of the starting players, or -1 if the lineup isn't complete.
+		int GetAverageRating() const;
+
+		// Returns the slot the player given is starting in, or nullptr if the player isn't starting.
+		const Slot* GetStartingSlot(const Player& player) const;
+	};
+public:
+	SquadOptimizer() = delete;
+
+	// Returns how well the player given would perform in the position matching the ID given. Players keep their overall in their own
+	// position and lose a little of it in a compatible position, more in another position of the same category and the most out of it.
+	static int GetSlotRating(const Player& player, uint16_t positionID);
+
+	// Returns the lineup which gets the highest total rating out of the players given, along with the backup for every slot.
+	// The players are assigned to the formation's slots by solving it as an assignment problem (Hungarian algorithm), which takes
+	// O(slots^2 * players) time, so it's cheap enough to run whenever a squad changes.
+	static Lineup GetBestLineup(const std::vector<Player*>& players);
+
+	// Returns the best lineup of the club given.
+	static Lineup GetBestLineup(const Club& club);
+
+	// Returns how much the total rating of the club's best lineup (given as the current lineup) would go up by if the player given was signed.
+	static int GetLineupGain(const Club& club, const Lineup& currentLineup, const Player& player);
+};
+
+#endif
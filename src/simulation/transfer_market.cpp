@@ -0,0 +1,243 @@
+#include <simulation/transfer_market.h>
+#include <simulation/player_valuation.h>
+#include <simulation/squad_optimizer.h>
+#include <serialization/save_data.h>
+#include <util/random_engine.h>
+#include <util/data_manip.h>
+#include <util/parallel.h>
+#include <util/globals.h>
+
+#include <algorithm>
+#include <unordered_set>
+
+namespace
+{
+    // The number of players of each position category an AI club aims to have in its squad
+    constexpr std::array<int, 4> targetCategorySizes = { 3, 8, 8, 5 };
+
+    // The chance of an AI club entering the market during a tick
+    constexpr float activityChance = 0.15f;
+
+    // The chance of an AI club without any squad shortages looking to upgrade a position
+    constexpr float upgradeChance = 0.35f;
+
+    // The number of random players in the chosen overall range an AI club considers before giving up for the tick
+    constexpr int maxCandidatesConsidered = 8;
+
+    // AI clubs aren't given budgets in the database, so their spending is capped relative to their most valuable player instead
+    constexpr float maxValueRelativeToSquad = 1.5f;
+
+    // AI clubs won't sell players if it would leave them with fewer players than this
+    constexpr size_t minSellerSquadSize = 18;
+}
+
+void TransferMarket::BuildIndexes()
+{
+    // Players involved in a pending transfer message are left alone, so the AI market never pulls a player out of an ongoing negotiation
+    std::unordered_set<uint16_t> negotiatingPlayers;
+    for (const Club& club : SaveData::GetInstance().GetClubDatabase())
+    {
+        for (const Club::Transfer& transferMsg : club.GetTransferMessages())
+            negotiatingPlayers.insert(transferMsg.playerID);
+    }
+
+    for (std::vector<Player*>& category : this->positionIndex)
+        category.clear();
+
+    this->buyerClubs.clear();
+
+    for (Club& club : SaveData::GetInstance().GetClubDatabase())
+    {
+        // Only AI clubs take part in the market
+        bool clubControlledByUser = false;
+        for (UserProfile& user : SaveData::GetInstance().GetUsers())
+        {
+            if (user.GetClub()->GetID() == club.GetID())
+            {
+                clubControlledByUser = true;
+                break;
+            }
+        }
+
+        // Clubs with fewer than 11 players most likely aren't in the game, so leave them out entirely
+        if (clubControlledByUser || club.GetAverageOverall() == -1)
+            continue;
+
+        if (club.GetPlayers().size() < Globals::maxSquadSize)
+            this->buyerClubs.emplace_back(&club);
+
+        if (club.GetPlayers().size() > minSellerSquadSize)
+        {
+            for (Player* player : club.GetPlayers())
+            {
+                if (negotiatingPlayers.count(player->GetID()) == 0)
+                    this->positionIndex[(size_t)SaveData::GetInstance().GetPositionTraits(player->GetPosition()).category].emplace_back(player);
+            }
+        }
+    }
+
+    for (std::vector<Player*>& category : this->positionIndex)
+    {
+        std::sort(category.begin(), category.end(), [](const Player* first, const Player* second)
+            {
+                if (first->GetOverall() != second->GetOverall())
+                    return first->GetOverall() < second->GetOverall();
+
+                return first->GetID() < second->GetID();
+            });
+    }
+}
+
+bool TransferMarket::EvaluateClub(const Club& club, RandomStream& stream, Bid& bid) const
+{
+    if (stream.GenerateRandom<float>(0.0f, 1.0f) >= activityChance)
+        return false;
+
+    // Tally up the club's players in each position category, and note the value of its most valuable player
+    std::array<int, 4> categorySizes = { 0, 0, 0, 0 };
+    int highestPlayerValue = 0;
+
+    for (const Player* player : club.GetPlayers())
+    {
+        ++categorySizes[(size_t)SaveData::GetInstance().GetPositionTraits(player->GetPosition()).category];
+        highestPlayerValue = std::max(highestPlayerValue, player->GetValue());
+    }
+
+    // The club looks to fill its largest squad shortage first, otherwise it may look to upgrade a random position
+    int neededCategory = -1, largestShortage = 0;
+    for (size_t category = 0; category < categorySizes.size(); category++)
+    {
+        if (targetCategorySizes[category] - categorySizes[category] > largestShortage)
+        {
+            largestShortage = targetCategorySizes[category] - categorySizes[category];
+            neededCategory = (int)category;
+        }
+    }
+
+    const SquadOptimizer::Lineup lineup = SquadOptimizer::GetBestLineup(club);
+    const int averageOverall = lineup.GetAverageRating();
+    int minOverall = averageOverall - 4, maxOverall = averageOverall + 3;
+
+    const bool upgradingLineup = (neededCategory == -1);
+    if (upgradingLineup)
+    {
+        if (stream.GenerateRandom<float>(0.0f, 1.0f) >= upgradeChance)
+            return false;
+
+        neededCategory = stream.GenerateRandom<int>(0, 3);
+        minOverall = averageOverall + 1;
+        maxOverall = averageOverall + 5;
+    }
+
+    // Find the players of the needed position category within the overall range
+    const std::vector<Player*>& candidates = this->positionIndex[neededCategory];
+    auto first = std::lower_bound(candidates.begin(), candidates.end(), minOverall,
+        [](const Player* player, int overall) { return player->GetOverall() < overall; });
+    auto last = std::upper_bound(first, candidates.end(), maxOverall,
+        [](int overall, const Player* player) { return overall < player->GetOverall(); });
+
+    const int totalCandidates = (int)(last - first);
+    if (totalCandidates == 0)
+        return false;
+
+    const int maxAffordableValue = (int)(highestPlayerValue * maxValueRelativeToSquad);
+    for (int attempt = 0; attempt < std::min(totalCandidates, maxCandidatesConsidered); attempt++)
+    {
+        Player* player = *(first + stream.GenerateRandom<int>(0, totalCandidates - 1));
+        if (player->GetClub() == club.GetID() || player->GetValue() > maxAffordableValue)
+            continue;
+
+        // An upgrade is only worth bidding for if the player would actually improve the club's best starting 11
+        if (upgradingLineup && SquadOptimizer::GetLineupGain(club, lineup, *player) <= 0)
+            continue;
+
+        bid.buyerClub = const_cast<Club*>(&club);
+        bid.sellerClub = SaveData::GetInstance().GetClub(player->GetClub());
+        bid.player = player;
+        bid.transferFee = Util::GetTruncatedSFInteger((int)(player->GetValue() * stream.GenerateRandom<float>(1.0f, 1.35f)), 4);
+
+        return bid.sellerClub != nullptr;
+    }
+
+    return false;
+}
+
+void TransferMarket::MergeBids(uint64_t tickSeed)
+{
+    // Drop the clubs which didn't bid, then order the bids so the result doesn't depend on how the evaluation was scheduled.
+    // The highest bid for each player gets the first chance to complete, ties are broken by the lower club ID.
+    this->bids.erase(std::remove_if(this->bids.begin(), this->bids.end(), [](const Bid& bid) { return bid.player == nullptr; }), this->bids.end());
+
+    std::sort(this->bids.begin(), this->bids.end(), [](const Bid& first, const Bid& second)
+        {
+            if (first.player->GetID() != second.player->GetID())
+                return first.player->GetID() < second.player->GetID();
+
+            if (first.transferFee != second.transferFee)
+                return first.transferFee > second.transferFee;
+
+            return first.buyerClub->GetID() < second.buyerClub->GetID();
+        });
+
+    for (const Bid& bid : this->bids)
+    {
+        // Earlier transfers this tick may have invalidated the bid
+        if (bid.player->GetClub() != bid.sellerClub->GetID() || bid.buyerClub->GetPlayers().size() >= Globals::maxSquadSize ||
+            bid.sellerClub->GetPlayers().size() <= minSellerSquadSize)
+        {
+            continue;
+        }
+
+        const SaveData::PositionTraits& positionTraits = SaveData::GetInstance().GetPositionTraits(bid.player->GetPosition());
+        if ((positionTraits.goalkeeper && bid.sellerClub->GetTotalGoalkeepers() <= Globals::minGoalkeepers) ||
+            (!positionTraits.goalkeeper && bid.sellerClub->GetTotalOutfielders() <= Globals::minOutfielders))
+        {
+            continue;
+        }
+
+        // Generate the player's new contract terms
+        RandomStream contractStream(tickSeed, 0x10000ull + bid.player->GetID());
+        const int contractLength = contractStream.GenerateRandom<int>(bid.player->GetAge() > 26 ? 2 : 3, 5);
+        const int expectedWage = std::max(PlayerValuation::GetInstance().GetValuation(bid.player->GetID()).expectedWage, bid.player->GetWage());
+        const int contractWage = Util::GetTruncatedSFInteger((int)(expectedWage * contractStream.GenerateRandom<float>(1.0f, 1.25f)), 3);
+
+        bid.player->SetExpiryYear(SaveData::GetInstance().GetCurrentYear() + contractLength);
+        bid.player->SetWage(contractWage);
+        bid.player->SetReleaseClause(0);
+        bid.player->SetTransferListed(false);
+
+        // Move the player to his new club
+        bid.buyerClub->AddPlayer(bid.player);
+        bid.sellerClub->RemovePlayer(bid.player);
+
+        SaveData::GetInstance().GetTransferHistory().push_back({ bid.player->GetID(), bid.sellerClub->GetID(), bid.buyerClub->GetID(),
+            bid.transferFee });
+    }
+}
+
+void TransferMarket::SimulateTick()
+{
+    this->BuildIndexes();
+
+    // Every club draws from its own stream seeded by the tick, so the outcome is the same no matter how the clubs are split across threads
+    const uint64_t tickSeed = RandomEngine::GetInstance().DeriveSeed();
+
+    this->bids.assign(this->buyerClubs.size(), Bid());
+    Util::ParallelFor(this->buyerClubs.size(), [this, tickSeed](size_t begin, size_t end)
+        {
+            for (size_t index = begin; index < end; index++)
+            {
+                RandomStream stream(tickSeed, this->buyerClubs[index]->GetID());
+                if (!this->EvaluateClub(*this->buyerClubs[index], stream, this->bids[index]))
+                    this->bids[index] = Bid();
+            }
+        });
+
+    this->MergeBids(tickSeed);
+}
+
+TransferMarket& TransferMarket::GetInstance()
+{
+    static TransferMarket instance;
+    return instance;
+}
@@ -0,0 +1,50 @@
+#ifndef TRANSFER_MARKET_H
+#define TRANSFER_MARKET_H
+
+#include <serialization/club_entity.h>
+#include <util/random_stream.h>
+
+#include <array>
+#include <vector>
+
+class TransferMarket
+{
+private:
+	struct Bid
+	{
+		Club* buyerClub = nullptr;
+		Club* sellerClub = nullptr;
+		Player* player = nullptr;
+		int transferFee = 0;
+	};
+
+	// The players available to AI clubs, indexed by position category and sorted by overall in ascending order
+	std::array<std::vector<Player*>, 4> positionIndex;
+
+	std::vector<Club*> buyerClubs;
+	std::vector<Bid> bids;
+private:
+	TransferMarket() = default;
+
+	// Rebuilds the buyer club list and the position index from the current state of the save's database.
+	void BuildIndexes();
+
+	// Evaluates the needs of the AI club given, and fills in the bid given if the club decides to bid for a player.
+	// Returns TRUE if a bid was made, else FALSE is returned. This only reads from the save's database, so it is safe to run in parallel.
+	bool EvaluateClub(const Club& club, RandomStream& stream, Bid& bid) const;
+
+	// Resolves the bids made this tick in a fixed order and completes every transfer which is still valid.
+	void MergeBids(uint64_t tickSeed);
+public:
+	TransferMarket(const TransferMarket& other) = delete;
+	TransferMarket(TransferMarket&& temp) noexcept = delete;
+	~TransferMarket() = default;
+
+	// Simulates one tick of the transfer market between AI controlled clubs.
+	void SimulateTick();
+
+	// Returns singleton instance object of this class.
+	static TransferMarket& GetInstance();
+};
+
+#endif
@@ -0,0 +1,138 @@
+#include <simulation/transfer_price_oracle.h>
+#include <serialization/save_data.h>
+#include <util/random_engine.h>
+#include <util/data_manip.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    // A fee which falls short of the price by no more than this factor gets a counter offer rather than being turned down
+    constexpr float counterOfferFactor = 1.75f;
+
+    // Returns the price at the percentile given of a uniform draw from the range given, truncated to 4 significant figures.
+    inline int GetPercentilePrice(int min, int max, float percentile)
+    {
+        return Util::GetTruncatedSFInteger(min + (int)((float)(max - min) * percentile), 4);
+    }
+}
+
+const TransferPriceOracle::Entry& TransferPriceOracle::GetEntry(const Player& player)
+{
+    if (player.GetID() >= this->entries.size())
+        this->entries.resize((size_t)player.GetID() + 1);
+
+    Entry& entry = this->entries[player.GetID()];
+    const int currentYear = SaveData::GetInstance().GetCurrentYear();
+
+    if (entry.value == player.GetValue() && entry.expiryYear == player.GetExpiryYear() && entry.releaseClause == player.GetReleaseClause() &&
+        entry.currentYear == currentYear && entry.clubID == player.GetClub())
+    {
+        return entry;
+    }
+
+    entry.value = player.GetValue();
+    entry.expiryYear = player.GetExpiryYear();
+    entry.releaseClause = player.GetReleaseClause();
+    entry.currentYear = currentYear;
+    entry.clubID = player.GetClub();
+
+    // Clubs demand more for players with plenty of time left on their contract, and are willing to pay more for them too
+    const float yearsLeftOnContract = (float)(entry.expiryYear - currentYear);
+
+    entry.sellerMin = (int)(std::floor((float)entry.value / 1.5f));
+    entry.sellerMax = (int)(std::ceil((float)entry.value * (1.5f + (yearsLeftOnContract / 10.0f))));
+
+    entry.buyerMin = (int)(std::floor((float)entry.value / 2.0f));
+    entry.buyerMax = (int)(std::ceil((float)entry.value * std::clamp(yearsLeftOnContract / 2.0f, 1.0f, 1.5f)));
+
+    entry.sellerMinimum.lower = TransferPriceOracle::GetSellerDemand(entry, GetPercentilePrice(entry.sellerMin, entry.sellerMax, 0.25f));
+    entry.sellerMinimum.median = TransferPriceOracle::GetSellerDemand(entry, GetPercentilePrice(entry.sellerMin, entry.sellerMax, 0.5f));
+    entry.sellerMinimum.upper = TransferPriceOracle::GetSellerDemand(entry, GetPercentilePrice(entry.sellerMin, entry.sellerMax, 0.75f));
+
+    entry.buyerMaximum.lower = GetPercentilePrice(entry.buyerMin, entry.buyerMax, 0.25f);
+    entry.buyerMaximum.median = GetPercentilePrice(entry.buyerMin, entry.buyerMax, 0.5f);
+    entry.buyerMaximum.upper = GetPercentilePrice(entry.buyerMin, entry.buyerMax, 0.75f);
+
+    return entry;
+}
+
+int TransferPriceOracle::GetSellerDemand(const Entry& entry, int drawnPrice)
+{
+    if (entry.releaseClause > 0 && drawnPrice > entry.releaseClause)
+        return entry.releaseClause;
+
+    return drawnPrice;
+}
+
+float TransferPriceOracle::GetSellerChanceAtMost(const Entry& entry, int transferFee)
+{
+    if (entry.releaseClause > 0 && entry.releaseClause <= transferFee)
+        return 1.0f;
+
+    return (float)Util::CountTruncatedSFAtMost(entry.sellerMin, entry.sellerMax, transferFee, 4) / (float)(entry.sellerMax - entry.sellerMin + 1);
+}
+
+float TransferPriceOracle::GetBuyerChanceAtLeast(const Entry& entry, int transferFee)
+{
+    return 1.0f -
+        ((float)Util::CountTruncatedSFAtMost(entry.buyerMin, entry.buyerMax, transferFee - 1, 4) / (float)(entry.buyerMax - entry.buyerMin + 1));
+}
+
+int TransferPriceOracle::DrawSellerMinimum(const Player& player)
+{
+    const Entry& entry = this->GetEntry(player);
+    return TransferPriceOracle::GetSellerDemand(entry,
+        Util::GetTruncatedSFInteger(RandomEngine::GetInstance().GenerateRandom<int>(entry.sellerMin, entry.sellerMax), 4));
+}
+
+int TransferPriceOracle::DrawBuyerMaximum(const Player& player)
+{
+    const Entry& entry = this->GetEntry(player);
+    return Util::GetTruncatedSFInteger(RandomEngine::GetInstance().GenerateRandom<int>(entry.buyerMin, entry.buyerMax), 4);
+}
+
+TransferPriceOracle::Quartiles TransferPriceOracle::GetSellerMinimum(const Player& player)
+{
+    return this->GetEntry(player).sellerMinimum;
+}
+
+TransferPriceOracle::Quartiles TransferPriceOracle::GetBuyerMaximum(const Player& player)
+{
+    return this->GetEntry(player).buyerMaximum;
+}
+
+TransferPriceOracle::Outlook TransferPriceOracle::GetSellerOutlook(const Player& player, int transferFee)
+{
+    const Entry& entry = this->GetEntry(player);
+
+    // The fee is accepted if it meets the club's demand, and countered if it's within the counter offer factor of it
+    Outlook outlook;
+    outlook.accept = TransferPriceOracle::GetSellerChanceAtMost(entry, transferFee);
+    outlook.counter = TransferPriceOracle::GetSellerChanceAtMost(entry, (int)std::floor((float)transferFee * counterOfferFactor)) -
+        outlook.accept;
+    outlook.reject = 1.0f - outlook.accept - outlook.counter;
+
+    return outlook;
+}
+
+TransferPriceOracle::Outlook TransferPriceOracle::GetBuyerOutlook(const Player& player, int transferFee)
+{
+    const Entry& entry = this->GetEntry(player);
+
+    // The fee is accepted if the club is willing to pay it, and countered if the club is willing to pay within the counter offer factor of it
+    Outlook outlook;
+    outlook.accept = TransferPriceOracle::GetBuyerChanceAtLeast(entry, transferFee);
+    outlook.counter = TransferPriceOracle::GetBuyerChanceAtLeast(entry, (int)std::ceil((float)transferFee / counterOfferFactor)) -
+        outlook.accept;
+    outlook.reject = 1.0f - outlook.accept - outlook.counter;
+
+    return outlook;
+}
+
+TransferPriceOracle& TransferPriceOracle::GetInstance()
+{
+    static TransferPriceOracle instance;
+    return instance;
+}
@@ -0,0 +1,76 @@
+#ifndef TRANSFER_PRICE_ORACLE_H
+#define TRANSFER_PRICE_ORACLE_H
+
+#include <serialization/player_entity.h>
+#include <vector>
+
+class TransferPriceOracle
+{
+public:
+	// The chances of an AI club accepting, countering or rejecting a transfer fee
+	struct Outlook
+	{
+		float accept = 0.0f, counter = 0.0f, reject = 0.0f;
+	};
+
+	// The lower quartile, median and upper quartile of a price
+	struct Quartiles
+	{
+		int lower = 0, median = 0, upper = 0;
+	};
+private:
+	// The prices the AI clubs demand or offer for a player are drawn uniformly from these ranges and then truncated to 4 significant
+	// figures. A selling club never demands more than the player's release clause.
+	struct Entry
+	{
+		// The inputs the prices were worked out from, the entry is only recomputed once one of these changes
+		int value = -1, expiryYear = -1, releaseClause = -1, currentYear = -1;
+		uint16_t clubID = 0;
+
+		int sellerMin = 0, sellerMax = 0, buyerMin = 0, buyerMax = 0;
+		Quartiles sellerMinimum, buyerMaximum;
+	};
+
+	std::vector<Entry> entries; // Indexed by player ID
+private:
+	TransferPriceOracle() = default;
+
+	// Returns the cached entry of the player given, recomputing it if the player's value, contract, club or release clause has changed.
+	const Entry& GetEntry(const Player& player);
+
+	// Returns the lowest fee a selling club would demand from the drawn price given.
+	static int GetSellerDemand(const Entry& entry, int drawnPrice);
+
+	// Returns the chance of the selling club demanding no more than the fee given.
+	static float GetSellerChanceAtMost(const Entry& entry, int transferFee);
+
+	// Returns the chance of the buying club being willing to pay at least the fee given.
+	static float GetBuyerChanceAtLeast(const Entry& entry, int transferFee);
+public:
+	TransferPriceOracle(const TransferPriceOracle& other) = delete;
+	TransferPriceOracle(TransferPriceOracle&& temp) noexcept = delete;
+	~TransferPriceOracle() = default;
+
+	// Returns a randomly drawn lowest fee an AI club would accept for the player given.
+	int DrawSellerMinimum(const Player& player);
+
+	// Returns a randomly drawn highest fee an AI club would be willing to pay for the player given.
+	int DrawBuyerMaximum(const Player& player);
+
+	// Returns the quartiles of the lowest fee an AI club would accept for the player given.
+	Quartiles GetSellerMinimum(const Player& player);
+
+	// Returns the quartiles of the highest fee an AI club would be willing to pay for the player given.
+	Quartiles GetBuyerMaximum(const Player& player);
+
+	// Returns the chances of an AI club selling the player given accepting, countering or rejecting the fee given.
+	Outlook GetSellerOutlook(const Player& player, int transferFee);
+
+	// Returns the chances of an AI club buying the player given accepting, countering or pulling out at the fee given.
+	Outlook GetBuyerOutlook(const Player& player, int transferFee);
+
+	// Returns singleton instance object of this class.
+	static TransferPriceOracle& GetInstance();
+};
+
+#endif
@@ -14,6 +14,14 @@ void ContractNegotiation::Init()
     // Initialize the member variables
     this->exitState = this->wentBack = this->onNegotiationCooldown = this->lengthInvalid = this->wageInvalid = this->releaseClauseInvalid = 
         this->sellerSquadTooSmall = this->buyerSquadTooLarge = this->tooGoodForClub = false;
+
+    this->projectedBudgets = FinancialProjection::Projection();
+    this->projectedWage = this->projectedLength = 0;
+
+    this->acceptanceSurface = ContractAcceptance::Surface();
+    this->suggestedTerms = ContractAcceptance::Terms();
+    this->acceptanceWage = this->acceptanceLength = this->acceptanceReleaseClause = -1;
+    this->offerAcceptance = 0.0f;
     
     // Fetch the Bahnschrift Bold font
     this->font = FontLoader::GetInstance().GetFont("Bahnschrift Bold");
@@ -21,8 +29,11 @@ void ContractNegotiation::Init()
     if (!this->renewingContract)
     {
         // Make sure the buying user's squad isn't at the maximum limit and that the selling team is not at the minimum squad limit
-        if ((this->negotiatingPlayer->GetPosition() == 0 && SaveData::GetInstance().GetClub(this->negotiatingPlayer->GetClub())->GetTotalGoalkeepers() <= Globals::minGoalkeepers) ||
-            ((this->negotiatingPlayer->GetPosition() > 0 && SaveData::GetInstance().GetClub(this->negotiatingPlayer->GetClub())->GetTotalOutfielders() <= Globals::minOutfielders)))
+        const SaveData::PositionTraits& positionTraits = SaveData::GetInstance().GetPositionTraits(this->negotiatingPlayer->GetPosition());
+        const Club* sellingClub = SaveData::GetInstance().GetClub(this->negotiatingPlayer->GetClub());
+
+        if ((positionTraits.goalkeeper && sellingClub->GetTotalGoalkeepers() <= Globals::minGoalkeepers) ||
+            (!positionTraits.goalkeeper && sellingClub->GetTotalOutfielders() <= Globals::minOutfielders))
         {
             this->sellerSquadTooSmall = true;
         }
@@ -102,6 +113,8 @@ void ContractNegotiation::Init()
         this->userInterface.AddTickBox("Release Clause Included", TickBox({ 60, 830 }, { 40, 40 }, "Include release clause in the contract?", 255, 0));
         this->userInterface.AddTextField("Release Clause", TextInputField({ 210, 970 }, { 300, 75 },
             TextInputField::Restrictions::NO_ALPHABETIC | TextInputField::Restrictions::NO_SPACES, 0));
+
+        this->InitAcceptanceSurface();
     }
 }
 
@@ -136,6 +149,94 @@ bool ContractNegotiation::ValidateInputs()
     return !this->lengthInvalid && !this->wageInvalid && !this->releaseClauseInvalid;
 }
 
+int ContractNegotiation::GetEnteredAmount(const std::string& fieldName)
+{
+    const std::string& enteredText = this->userInterface.GetTextField(fieldName)->GetInputtedText();
+    return (enteredText.empty() || enteredText.size() > 9) ? 0 : std::stoi(enteredText);
+}
+
+void ContractNegotiation::InitAcceptanceSurface()
+{
+    // The wages on the surface run across the range the player's lowest acceptable wage is drawn from
+    constexpr int totalWageSteps = 10;
+    const auto [minWage, maxWage] = ContractAcceptance::GetAcceptableWageRange(*this->negotiatingPlayer);
+
+    this->acceptanceSurface.lengths = { 1, 2, 3, 4, 5 };
+    this->acceptanceSurface.wages.clear();
+
+    for (int step = 0; step < totalWageSteps; step++)
+    {
+        const int wage = minWage + (int)(((float)(maxWage - minWage) * (float)step) / (float)(totalWageSteps - 1));
+        this->acceptanceSurface.wages.emplace_back(Util::GetTruncatedSFInteger(std::max(wage, 100), 3));
+    }
+
+    // Suggest the cheapest terms the player is very likely to accept, trying out no release clause and a few release clauses around the
+    // one the player would like
+    const auto [minReleaseClause, maxReleaseClause] = ContractAcceptance::GetPreferredReleaseClauseRange(*this->negotiatingPlayer);
+    const std::vector<int> releaseClauses = { 0, minReleaseClause, (minReleaseClause + maxReleaseClause) / 2, maxReleaseClause,
+        maxReleaseClause * 2 };
+
+    const ContractAcceptance::Surface suggestionSurface = ContractAcceptance::Evaluate(*this->negotiatingPlayer, this->renewingContract,
+        this->acceptanceSurface.lengths, this->acceptanceSurface.wages, releaseClauses);
+
+    // A renewal only has to fit the rise over the player's current wage into the budget, while a new signing has to fit the whole wage
+    const Club* userClub = MainGame::GetAppState()->GetCurrentUser()->GetClub();
+    const int affordableWage = userClub->GetWageBudget() + (this->renewingContract ? this->negotiatingPlayer->GetWage() : 0);
+    this->suggestedTerms = suggestionSurface.GetSuggestedTerms(0.75f, affordableWage);
+}
+
+void ContractNegotiation::UpdateAcceptance()
+{
+    const int wage = this->GetEnteredAmount("Wage");
+    const int contractLength = this->userInterface.GetDropDown("Amount Of Years")->GetCurrentSelected();
+    const int releaseClause = this->userInterface.GetTickBox("Release Clause Included")->isCurrentlyTicked() ? 
+        this->GetEnteredAmount("Release Clause") : 0;
+
+    if (releaseClause != this->acceptanceReleaseClause)
+    {
+        this->acceptanceSurface = ContractAcceptance::Evaluate(*this->negotiatingPlayer, this->renewingContract, this->acceptanceSurface.lengths,
+            this->acceptanceSurface.wages, { releaseClause });
+    }
+    else if (wage == this->acceptanceWage && contractLength == this->acceptanceLength)
+        return;
+
+    this->acceptanceWage = wage;
+    this->acceptanceLength = contractLength;
+    this->acceptanceReleaseClause = releaseClause;
+
+    this->offerAcceptance = (wage > 0 && contractLength > 0) ? 
+        ContractAcceptance::GetLengthAcceptance(*this->negotiatingPlayer, this->renewingContract, contractLength) *
+        ContractAcceptance::GetWageAcceptance(*this->negotiatingPlayer, wage) * 
+        ContractAcceptance::GetReleaseClauseAcceptance(*this->negotiatingPlayer, releaseClause) : 0.0f;
+}
+
+void ContractNegotiation::UpdateProjectedBudgets()
+{
+    const int wage = this->GetEnteredAmount("Wage");
+    const int contractLength = this->userInterface.GetDropDown("Amount Of Years")->GetCurrentSelected();
+
+    if (wage == this->projectedWage && contractLength == this->projectedLength)
+        return;
+
+    this->projectedWage = wage;
+    this->projectedLength = contractLength;
+
+    if (wage <= 0 || contractLength <= 0)
+    {
+        this->projectedBudgets = FinancialProjection::Projection();
+        return;
+    }
+
+    // Project the club's wage budgets over the length of the contract, as if the player had signed on the wage being offered
+    FinancialProjection::Signing signing;
+    signing.wage = wage;
+    signing.expiryYear = SaveData::GetInstance().GetCurrentYear() + contractLength;
+    signing.goalkeeper = SaveData::GetInstance().GetPositionTraits(this->negotiatingPlayer->GetPosition()).goalkeeper;
+
+    this->projectedBudgets = FinancialProjection::GetInstance().Project(*MainGame::GetAppState()->GetCurrentUser()->GetClub(), contractLength,
+        signing);
+}
+
 void ContractNegotiation::Update(const float& deltaTime)
 {
     if (!this->exitState)
@@ -170,6 +271,11 @@ void ContractNegotiation::Update(const float& deltaTime)
                 this->userInterface.GetTextField("Release Clause")->SetOpacity(255);
             else
                 this->userInterface.GetTextField("Release Clause")->SetOpacity(0);
+
+            this->UpdateAcceptance();
+
+            if (!this->renewingContract)
+                this->UpdateProjectedBudgets();
         }
     }
     else
@@ -221,6 +327,59 @@ void ContractNegotiation::Render() const
         Renderer::GetInstance().RenderShadowedText({ 60, 650 }, { glm::vec3(255), this->userInterface.GetOpacity() }, this->font, 40,
             "Enter the wage amount you want to offer:", 5);
 
+        // Render the chance of the player accepting the terms offered, along with the suggested terms
+        if (this->acceptanceWage > 0 && this->acceptanceLength > 0)
+        {
+            Renderer::GetInstance().RenderShadowedText({ 800, 480 }, { glm::vec3(255), this->userInterface.GetOpacity() }, this->font, 35,
+                "Chance of the player accepting these terms: " + std::to_string((int)std::round(this->offerAcceptance * 100.0f)) + "%", 5);
+        }
+
+        Renderer::GetInstance().RenderShadowedText({ 800, 530 }, { glm::vec3(255), this->userInterface.GetOpacity() }, this->font, 30,
+            "Suggested: " + std::to_string(this->suggestedTerms.length) + " years on " + Util::GetFormattedCashString(this->suggestedTerms.wage) + 
+            (this->suggestedTerms.releaseClause > 0 ? ", release clause " + Util::GetFormattedCashString(this->suggestedTerms.releaseClause) : 
+            ", no release clause") + " (" + std::to_string((int)std::round(this->suggestedTerms.probability * 100.0f)) + "%)", 5);
+
+        // Render the heat map of the chance of acceptance, each row is a contract length and the wages offered go up from left to right
+        for (size_t lengthIndex = 0; lengthIndex < this->acceptanceSurface.lengths.size(); lengthIndex++)
+        {
+            const float rowPosition = 600.0f + (lengthIndex * 42.0f);
+            Renderer::GetInstance().RenderShadowedText({ 800, rowPosition + 10.0f }, { glm::vec3(255), this->userInterface.GetOpacity() }, 
+                this->font, 30, std::to_string(this->acceptanceSurface.lengths[lengthIndex]) + " YR", 5);
+
+            for (size_t wageIndex = 0; wageIndex < this->acceptanceSurface.wages.size(); wageIndex++)
+            {
+                const float probability = this->acceptanceSurface.GetProbability(lengthIndex, wageIndex, 0);
+                Renderer::GetInstance().RenderSquare({ 910.0f + (wageIndex * 56.0f), rowPosition }, { 52, 38 },
+                    { glm::vec3(200, 40, 40) + (glm::vec3(-160, 160, 0) * probability), this->userInterface.GetOpacity() });
+            }
+        }
+
+        if (!this->acceptanceSurface.wages.empty())
+        {
+            Renderer::GetInstance().RenderShadowedText({ 885, 835 }, { glm::vec3(255), this->userInterface.GetOpacity() }, this->font, 25,
+                Util::GetFormattedCashString(this->acceptanceSurface.wages.front()), 5);
+
+            const std::string highestWageText = Util::GetFormattedCashString(this->acceptanceSurface.wages.back());
+            Renderer::GetInstance().RenderShadowedText({ 1440 - Renderer::GetInstance().GetTextSize(this->font, 25, highestWageText).x, 835 }, 
+                { glm::vec3(255), this->userInterface.GetOpacity() }, this->font, 25, highestWageText, 5);
+        }
+
+        // Render the projected wage budgets of the club over the length of the contract being offered
+        if (!this->projectedBudgets.wageBudgets.empty())
+        {
+            Renderer::GetInstance().RenderShadowedText({ 800, 890 }, { glm::vec3(255), this->userInterface.GetOpacity() }, this->font, 30,
+                "Projected wage budget at the start of each season:", 5);
+
+            for (size_t index = 0; index < this->projectedBudgets.wageBudgets.size(); index++)
+            {
+                const FinancialProjection::Band& band = this->projectedBudgets.wageBudgets[index];
+                Renderer::GetInstance().RenderShadowedText({ 800 + ((index % 2) * 370.0f), 935 + ((index / 2) * 35.0f) }, 
+                    { glm::vec3(255), this->userInterface.GetOpacity() }, this->font, 25, "- " + 
+                    std::to_string(SaveData::GetInstance().GetCurrentYear() + index + 1) + ": " + Util::GetFormattedCashString(band.lower) + 
+                    " to " + Util::GetFormattedCashString(band.upper), 5);
+            }
+        }
+
         if (this->userInterface.GetTextField("Release Clause")->GetOpacity() == 255)
         {
             Renderer::GetInstance().RenderShadowedText({ 60, 910 }, { glm::vec3(255), this->userInterface.GetOpacity() }, this->font, 40,
@@ -239,7 +398,10 @@ void ContractNegotiation::Render() const
     }
     else if (this->sellerSquadTooSmall)
     {
-        if (this->negotiatingPlayer->GetPosition() == 0 && SaveData::GetInstance().GetClub(this->negotiatingPlayer->GetClub())->GetTotalGoalkeepers() <= Globals::minGoalkeepers)
+        const SaveData::PositionTraits& positionTraits = SaveData::GetInstance().GetPositionTraits(this->negotiatingPlayer->GetPosition());
+        const Club* sellingClub = SaveData::GetInstance().GetClub(this->negotiatingPlayer->GetClub());
+
+        if (positionTraits.goalkeeper && sellingClub->GetTotalGoalkeepers() <= Globals::minGoalkeepers)
         {
             Renderer::GetInstance().RenderShadowedText({ 60, 200 }, { glm::vec3(255), this->userInterface.GetOpacity() }, this->font, 30,
                 std::string(SaveData::GetInstance().GetClub(this->negotiatingPlayer->GetClub())->GetName()) +
@@ -4,6 +4,8 @@
 #include <core/application_state.h>
 #include <interface/user_interface.h>
 #include <serialization/player_entity.h>
+#include <simulation/financial_projection.h>
+#include <simulation/contract_acceptance.h>
 
 class ContractNegotiation : public AppState
 {
@@ -14,12 +16,32 @@ private:
 	AppState* callerAppState;
 
 	bool* finishedNegotiating;
+	FinancialProjection::Projection projectedBudgets;
+	int projectedWage, projectedLength;
+
+	ContractAcceptance::Surface acceptanceSurface; // Lengths against wages, for the release clause currently being offered
+	ContractAcceptance::Terms suggestedTerms;
+	int acceptanceWage, acceptanceLength, acceptanceReleaseClause;
+	float offerAcceptance;
 	bool lengthInvalid, wageInvalid, releaseClauseInvalid;
 	bool exitState, wentBack, onNegotiationCooldown, sellerSquadTooSmall, buyerSquadTooLarge, tooGoodForClub,
 		renewingContract;
 private:
 	// Checks if the all the inputs given are valid.
 	bool ValidateInputs();
+
+	// Returns the amount entered into the text field given, or 0 if nothing (or an amount too large to be valid) has been entered.
+	int GetEnteredAmount(const std::string& fieldName);
+
+	// Works out the suggested terms and the chance of the player accepting terms around the ones given by the user.
+	void InitAcceptanceSurface();
+
+	// Updates the chance of the player accepting the terms offered if they have changed since the last update.
+	// The surface shown to the user is only re-evaluated when the release clause offered changes.
+	void UpdateAcceptance();
+
+	// Reprojects the club's wage budgets if the wage or contract length offered has changed since the last projection.
+	void UpdateProjectedBudgets();
 protected:
 	void Init() override;
 	void Destroy() override;
@@ -6,6 +6,7 @@
 #include <states/main_game.h>
 
 #include <serialization/save_data.h>
+#include <simulation/contract_acceptance.h>
 #include <interface/menu_button.h>
 #include <util/random_engine.h>
 #include <util/data_manip.h>
@@ -151,12 +152,8 @@ int ContractResponse::GenerateContractLengthResponse() const
 
     // Do small calculations to determine whether the player accepts the contract length given
     const int generatedMultiplier = RandomEngine::GetInstance().GenerateRandom<int>(100, 200);
-	int preferenceWeight = 0;
-
-	if (this->renewingContract)
-        preferenceWeight = (int)(((7 - (contractYearsRemaining + this->contractLength)) * generatedMultiplier) / (this->negotiatingPlayer->GetAge() / 20.0f));
-	else
-        preferenceWeight = (int)(((7 - this->contractLength) * generatedMultiplier) / (this->negotiatingPlayer->GetAge() / 22.0f));
+	const int preferenceWeight = 
+        ContractAcceptance::GetLengthPreferenceWeight(*this->negotiatingPlayer, this->renewingContract, this->contractLength, generatedMultiplier);
 
 	if (preferenceWeight < 300 && this->contractLength > 1)
 	{
@@ -182,8 +179,7 @@ int ContractResponse::GenerateWageResponse() const
     int requestedWages = -1; // If this remains as -1, then that means that they accepted it
 
     // Calculate the bounds of which the player could request a wage amount from
-    const int min = this->negotiatingPlayer->GetWage();
-    const int max = (int)(this->negotiatingPlayer->GetWage() * 2.25f);
+    const auto [min, max] = ContractAcceptance::GetAcceptableWageRange(*this->negotiatingPlayer);
     
     // Generate the minimum amount the player is willing to accept
     const int minAcceptableWage = Util::GetTruncatedSFInteger(RandomEngine::GetInstance().GenerateRandom<int>(min, max), 3);
@@ -200,11 +196,10 @@ int ContractResponse::GenerateReleaseClauseResponse(int contractLength) const
 
     // Generate number to decide whether the player should request a release clause or not
     const float generatedNum = (float)RandomEngine::GetInstance().GenerateRandom<int>(0, 100);
-    if (generatedNum > 100.0f - ((16.0f / (float)this->negotiatingPlayer->GetAge()) * 55.0f))
+    if (generatedNum > ContractAcceptance::GetReleaseClauseRequestThreshold(*this->negotiatingPlayer))
     {
         // Simple algorithm to decide the release clause preferred by the player
-        const int min = this->negotiatingPlayer->GetValue();
-        const int max = (int)(std::ceil((float)this->negotiatingPlayer->GetValue() * 1.5f));
+        const auto [min, max] = ContractAcceptance::GetPreferredReleaseClauseRange(*this->negotiatingPlayer);
 
         int preferredReleaseClause = Util::GetTruncatedSFInteger(RandomEngine::GetInstance().GenerateRandom<int>(min, max), 3);
 
@@ -3,6 +3,7 @@
 
 #include <interface/menu_button.h>
 #include <serialization/save_data.h>
+#include <simulation/financial_projection.h>
 #include <util/random_engine.h>
 #include <util/data_manip.h>
 
@@ -21,8 +22,6 @@ void FinancialsGeneration::Init()
     // Calculate the finances of each user in the save
     for (UserProfile& user : SaveData::GetInstance().GetUsers())
     {
-        const float objectiveBonusAmount = 0.4f / (float)user.GetClub()->GetObjectives().size();
-
         UserFinancials calculatedFinancials;
         calculatedFinancials.previousTransferBudget = user.GetClub()->GetTransferBudget();
         calculatedFinancials.previousWageBudget = user.GetClub()->GetWageBudget();
@@ -31,80 +30,26 @@ void FinancialsGeneration::Init()
         for (Player* player : user.GetClub()->GetPlayers())
             calculatedFinancials.totalWages += (player->GetWage() * 51);
 
-        int gamesWon = 0, gamesDrawn = 0, gamesLost = 0;
-        int totalObjectivesIncomplete = 0;
-
-        int totalWinnerBonus = 0;
-        float totalObjectiveBonus = 1.0f;
-
-        for (const UserProfile::CompetitionData& compStats : user.GetCompetitionData())
-        {
-            // Tally up the total games won, drawn and lost
-            gamesWon += compStats.currentWins;
-            gamesDrawn += compStats.currentDraws;
-            gamesLost += compStats.currentLosses;
-
-            // Add the revenue bonuses from the competitions won by the user
-            if (compStats.compID >= 1000) // DOMESTIC CUP COMPETITION
-            {
-                if (compStats.seasonEndPosition == SaveData::GetInstance().GetCup(compStats.compID)->GetRounds().size() + 1) // The user won the cup?
-                    totalWinnerBonus += SaveData::GetInstance().GetCup(compStats.compID)->GetWinnerBonus();
-                else if (compStats.seasonEndPosition == SaveData::GetInstance().GetCup(compStats.compID)->GetRounds().size()) // The user is runners up?
-                    totalWinnerBonus += (int)(SaveData::GetInstance().GetCup(compStats.compID)->GetWinnerBonus() / 2.5f);
-            }
-            else // LEAGUE COMPETITION
-            {
-                if (compStats.seasonEndPosition == 1)
-                    totalWinnerBonus += SaveData::GetInstance().GetLeague(compStats.compID)->GetTitleBonus();
-                else if (compStats.wonPlayoffs || (compStats.seasonEndPosition <= SaveData::GetInstance().GetLeague(compStats.compID)->GetAutoPromotionThreshold() && 
-                        compStats.seasonEndPosition != 0))
-                {
-                    totalWinnerBonus += (int)(SaveData::GetInstance().GetLeague(compStats.compID)->GetTitleBonus() / 2.5f);
-                }
-            }
-
-            // Tally up the total amount of club objectives that the user didn't complete
-            // Also add a revenue bonus per objective the user completed
-            for (const Club::Objective& objective : user.GetClub()->GetObjectives())
-            {
-                if (objective.compID == compStats.compID)
-                {
-                    if ((compStats.compID > 1000 && compStats.seasonEndPosition >= objective.targetEndPosition) ||
-                        (compStats.compID < 1000 && compStats.seasonEndPosition <= objective.targetEndPosition))
-                    {
-                        totalObjectiveBonus += objectiveBonusAmount;
-                    }
-                    else
-                    {
-                        ++totalObjectivesIncomplete;
-                    }
-
-                    break;
-                }
-            }
-        }
-
-        // Calculate the user's club's new wage budget
-        const int previousInitialWageBudget = user.GetClub()->GetInitialWageBudget();
-        user.GetClub()->SetInitialWageBudget(
-            Util::GetTruncatedSFInteger((int)((float)user.GetClub()->GetInitialWageBudget() * totalObjectiveBonus), 3));
+        // Tally up the games played, the revenue bonuses earned and the objectives completed over the season
+        const FinancialProjection::SeasonOutcome outcome = FinancialProjection::GetRecordedOutcome(user);
 
-        calculatedFinancials.newWageBudget = user.GetClub()->GetWageBudget() > user.GetClub()->GetInitialWageBudget() ?
-            user.GetClub()->GetWageBudget() + (user.GetClub()->GetInitialWageBudget() - previousInitialWageBudget) :
-            user.GetClub()->GetInitialWageBudget();
+        // Calculate the user's club's new wage and transfer budgets
+        FinancialProjection::Budgets budgets;
+        budgets.transferBudget = user.GetClub()->GetTransferBudget();
+        budgets.wageBudget = user.GetClub()->GetWageBudget();
+        budgets.initialTransferBudget = user.GetClub()->GetInitialTransferBudget();
+        budgets.initialWageBudget = user.GetClub()->GetInitialWageBudget();
 
-        // Calculate the user's club's new transfer budget
-        const int previousInitialTransferBudget = user.GetClub()->GetInitialTransferBudget();
-        user.GetClub()->SetInitialTransferBudget(
-            Util::GetTruncatedSFInteger((int)((float)user.GetClub()->GetInitialTransferBudget() * totalObjectiveBonus), 4));
+        FinancialProjection::ApplyBudgetRules(budgets, outcome);
 
-        calculatedFinancials.newTransferBudget = user.GetClub()->GetTransferBudget() > user.GetClub()->GetInitialTransferBudget() ?
-            user.GetClub()->GetTransferBudget() + totalWinnerBonus + (user.GetClub()->GetInitialTransferBudget() - previousInitialTransferBudget) :
-            user.GetClub()->GetInitialTransferBudget() + totalWinnerBonus;
+        user.GetClub()->SetInitialTransferBudget(budgets.initialTransferBudget);
+        user.GetClub()->SetInitialWageBudget(budgets.initialWageBudget);
+        calculatedFinancials.newTransferBudget = budgets.transferBudget;
+        calculatedFinancials.newWageBudget = budgets.wageBudget;
         
         // Calculate the total revenue made by the club
-        const float generatedRevenueMultiplier = ((gamesWon / 3.0f) + (gamesDrawn / 12.0f) + (user.GetClub()->GetAverageOverall() / 30.0f) * 
-            (totalObjectiveBonus + 1.0f)) + totalWinnerBonus;
+        const float generatedRevenueMultiplier = ((outcome.gamesWon / 3.0f) + (outcome.gamesDrawn / 12.0f) + 
+            (user.GetClub()->GetAverageOverall() / 30.0f) * (outcome.objectiveBonus + 1.0f)) + outcome.winnerBonus;
 
         calculatedFinancials.totalRevenue = (int)((float)RandomEngine::GetInstance().GenerateRandom<int>(1000000, 3500000) * (generatedRevenueMultiplier / 10.0f));
         calculatedFinancials.totalRevenue += calculatedFinancials.totalWages;
@@ -112,7 +57,7 @@ void FinancialsGeneration::Init()
         calculatedFinancials.totalRevenue = Util::GetTruncatedSFInteger(calculatedFinancials.totalRevenue * 20, 4);
 
         // Calculate the club's total expenses
-        const float generatedExpensesMultiplier = ((gamesLost / 7.0f) + (user.GetClub()->GetAverageOverall() / 45.0f));
+        const float generatedExpensesMultiplier = ((outcome.gamesLost / 7.0f) + (user.GetClub()->GetAverageOverall() / 45.0f));
         calculatedFinancials.totalExpenses = (int)((float)RandomEngine::GetInstance().GenerateRandom<int>(100000, 1500000) * generatedExpensesMultiplier);
         calculatedFinancials.totalExpenses += calculatedFinancials.totalWages;
 
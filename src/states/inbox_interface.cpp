@@ -26,7 +26,8 @@ void InboxInterface::Init()
         this->userInterface.AddButton(new MenuButton({ 1410, 1005 }, { 300, 100 }, { 315, 115 }, "CLEAR"));
 
     this->userInterface.AddSelectionList("Inbox Messages", { { 960, 490 }, { 1860, 720 }, 80, 255, 25 });
-    this->userInterface.GetSelectionList("Inbox Messages")->AddCategory("Inbox Messages");
+    this->userInterface.GetSelectionList("Inbox Messages")->SetSortingEnabled(true);
+    this->userInterface.GetSelectionList("Inbox Messages")->AddCategory("Inbox Messages", SelectionList::SortType::KEY);
 
     // Load the general/transfer messages
     if (this->type == InboxType::GENERAL)
@@ -41,9 +42,11 @@ void InboxInterface::LoadGeneralMessages()
 {
     this->userInterface.GetSelectionList("Inbox Messages")->Clear();
 
+    // The messages are sorted by the order they arrived in
+    int64_t arrivalOrder = 0;
     for (Club::GeneralMessage& generalMsg : MainGame::GetAppState()->GetCurrentUser()->GetClub()->GetGeneralMessages())
     {
-        this->userInterface.GetSelectionList("Inbox Messages")->AddElement({ generalMsg.message }, -1);
+        this->userInterface.GetSelectionList("Inbox Messages")->AddElement({ generalMsg.message }, std::vector<int64_t>{ arrivalOrder++ }, -1);
         generalMsg.wasRead = true;
     }
 }
@@ -55,6 +58,7 @@ void InboxInterface::LoadTransferMessages()
     for (size_t index = 0; index < MainGame::GetAppState()->GetCurrentUser()->GetClub()->GetTransferMessages().size(); index++)
     {
         Club::Transfer& transferMsg = MainGame::GetAppState()->GetCurrentUser()->GetClub()->GetTransferMessages()[index];
+        const std::vector<int64_t> sortKeys = { (int64_t)index }; // The messages are sorted by the order they arrived in
         
         // The transfer message recieved is a opening/counter offer or a "pulling out of negotiations" message from another buying club 
         if (MainGame::GetAppState()->GetCurrentUser()->GetClub()->GetID() != transferMsg.biddingClubID)
@@ -67,13 +71,13 @@ void InboxInterface::LoadTransferMessages()
             {
                 this->userInterface.GetSelectionList("Inbox Messages")->AddElement({ std::string(biddingClub->GetName()) +
                      " have submitted a counter offer of " + Util::GetFormattedCashString(transferMsg.transferFee) + " for " +
-                     targettedPlayer->GetName().data() }, (int)index);
+                     targettedPlayer->GetName().data() }, sortKeys, (int)index);
             }
             else // The transfer message is a opening offer
             {
                 this->userInterface.GetSelectionList("Inbox Messages")->AddElement({ std::string(biddingClub->GetName()) +
                     " have submitted an opening offer of " + Util::GetFormattedCashString(transferMsg.transferFee) + " for " +
-                    targettedPlayer->GetName().data() }, (int)index);
+                    targettedPlayer->GetName().data() }, sortKeys, (int)index);
             }
         }
         else // The transfer message recieved is a response message from the selling club
@@ -86,13 +90,13 @@ void InboxInterface::LoadTransferMessages()
             {
                 this->userInterface.GetSelectionList("Inbox Messages")->AddElement({ "You and " + std::string(sellingClub->GetName()) +
                     " have agreed a fee of " + Util::GetFormattedCashString(transferMsg.transferFee) + " for " + targettedPlayer->GetName().data() +
-                    ", you can now negotiate a contract with the player." }, (int)index);
+                    ", you can now negotiate a contract with the player." }, sortKeys, (int)index);
             }
             else // The transfer message indicates the selling club asking for a better transfer fee for the player being bidded for
             {
                 this->userInterface.GetSelectionList("Inbox Messages")->AddElement({ std::string(sellingClub->GetName()) +
                     " believe a transfer fee in the region of " + Util::GetFormattedCashString(transferMsg.transferFee) +
-                    " would be more suitable for " + targettedPlayer->GetName().data() + "." }, (int)index);
+                    " would be more suitable for " + targettedPlayer->GetName().data() + "." }, sortKeys, (int)index);
             }
         }
     }
@@ -21,11 +21,13 @@ void ManageSquad::Init()
     this->userInterface.AddButton(new MenuButton({ 1745, 1005 }, { 300, 100 }, { 315, 115 }, "BACK"));
 
     this->userInterface.AddSelectionList("Players", { { 960, 490 }, { 1860, 720 }, 80, 255, 25 });
+    this->userInterface.GetSelectionList("Players")->SetSortingEnabled(true);
     this->userInterface.GetSelectionList("Players")->AddCategory("Name");
     this->userInterface.GetSelectionList("Players")->AddCategory("Nation");
-    this->userInterface.GetSelectionList("Players")->AddCategory("Age");
-    this->userInterface.GetSelectionList("Players")->AddCategory("Position");
-    this->userInterface.GetSelectionList("Players")->AddCategory("Expiry Year");
+    this->userInterface.GetSelectionList("Players")->AddCategory("Age", SelectionList::SortType::KEY);
+    this->userInterface.GetSelectionList("Players")->AddCategory("Position", SelectionList::SortType::KEY);
+    this->userInterface.GetSelectionList("Players")->AddCategory("Expiry Year", SelectionList::SortType::KEY);
+    this->userInterface.GetSelectionList("Players")->AddCategory("Best XI", SelectionList::SortType::KEY);
     
     this->ReloadSquad();
 }
@@ -44,36 +46,40 @@ void ManageSquad::ReloadSquad()
 {
     this->userInterface.GetSelectionList("Players")->Clear();
 
+    this->bestLineup = SquadOptimizer::GetBestLineup(*this->currentUserClub);
+
     for (size_t index = 0; index < this->currentUserClub->GetPlayers().size(); index++)
     {
         const Player* player = this->currentUserClub->GetPlayers()[index];
 
+        // Players in the best starting 11 are shown with the position they're picked for, the rest are on the bench
+        const SquadOptimizer::Slot* startingSlot = this->bestLineup.GetStartingSlot(*player);
+        const std::vector<std::string> categoryValues = { player->GetName().data(), player->GetNation().data(), std::to_string(player->GetAge()), 
+            SaveData::GetInstance().GetPosition(player->GetPosition())->type, std::to_string(player->GetExpiryYear()),
+            startingSlot ? SaveData::GetInstance().GetPosition(startingSlot->positionID)->type : "SUB" };
+
+        // The best XI column is sorted in formation order, with the substitutes after the starters
+        const std::vector<int64_t> sortKeys = { 0, 0, player->GetAge(), player->GetPosition(), player->GetExpiryYear(),
+            startingSlot ? (int64_t)(startingSlot - this->bestLineup.slots.data()) : (int64_t)SquadOptimizer::lineupSize };
+
         if (player->GetTransferListed())
         {
             // Set the selection element color as RED if the player is transfer listed
-            this->userInterface.GetSelectionList("Players")->AddElement({ player->GetName().data(), player->GetNation().data(),
-                std::to_string(player->GetAge()), SaveData::GetInstance().GetPosition(player->GetPosition())->type,
-                std::to_string(player->GetExpiryYear()) }, (int)index, { 115, 20, 20 }, { 145, 20, 20 }, { 90, 20, 20 });
+            this->userInterface.GetSelectionList("Players")->AddElement(categoryValues, sortKeys, (int)index, { 115, 20, 20 }, { 145, 20, 20 }, { 90, 20, 20 });
         }
         else if (player->GetTransfersBlocked())
         {
             // Set the selection element color as RED if the player is transfer listed
-            this->userInterface.GetSelectionList("Players")->AddElement({ player->GetName().data(), player->GetNation().data(),
-                std::to_string(player->GetAge()), SaveData::GetInstance().GetPosition(player->GetPosition())->type,
-                std::to_string(player->GetExpiryYear()) }, (int)index, { 20, 20, 115 }, { 20, 20, 145 }, { 20, 20, 90 });
+            this->userInterface.GetSelectionList("Players")->AddElement(categoryValues, sortKeys, (int)index, { 20, 20, 115 }, { 20, 20, 145 }, { 20, 20, 90 });
         }
         else if (player->GetExpiryYear() - SaveData::GetInstance().GetCurrentYear() == 1)
         {
             // Set the selection element color as YELLOW if the player only has 1 year left on his contract
-            this->userInterface.GetSelectionList("Players")->AddElement({ player->GetName().data(), player->GetNation().data(),
-                std::to_string(player->GetAge()), SaveData::GetInstance().GetPosition(player->GetPosition())->type,
-                std::to_string(player->GetExpiryYear()) }, (int)index, { 115, 115, 20 }, { 145, 145, 20 }, { 90, 90, 20 });
+            this->userInterface.GetSelectionList("Players")->AddElement(categoryValues, sortKeys, (int)index, { 115, 115, 20 }, { 145, 145, 20 }, { 90, 90, 20 });
         }
         else
         {
-            this->userInterface.GetSelectionList("Players")->AddElement({ player->GetName().data(), player->GetNation().data(),
-                std::to_string(player->GetAge()), SaveData::GetInstance().GetPosition(player->GetPosition())->type,
-                std::to_string(player->GetExpiryYear()) }, (int)index);
+            this->userInterface.GetSelectionList("Players")->AddElement(categoryValues, sortKeys, (int)index);
         }
     }
 }
@@ -114,6 +120,9 @@ void ManageSquad::Render() const
     Renderer::GetInstance().RenderShadowedText({ 1450, 95 }, { glm::vec3(255), this->userInterface.GetOpacity() }, this->font, 75,
         "CLUB SQUAD", 5);
 
+    Renderer::GetInstance().RenderShadowedText({ 60, 1005 }, { 0, 200, 200, this->userInterface.GetOpacity() }, this->font, 40,
+        "BEST XI RATING: " + std::to_string(this->bestLineup.GetAverageRating()), 5);
+
     // Render the user interface
     this->userInterface.Render();
 }
@@ -4,6 +4,7 @@
 #include <core/application_state.h>
 #include <interface/user_interface.h>
 #include <serialization/club_entity.h>
+#include <simulation/squad_optimizer.h>
 
 class ManageSquad : public AppState
 {
@@ -11,6 +12,7 @@ private:
 	UserInterface userInterface;
 	FontPtr font;
 	Club* currentUserClub;
+	SquadOptimizer::Lineup bestLineup;
 	bool exitState;
 protected:
 	void Init() override;
@@ -5,7 +5,9 @@
 #include <interface/menu_button.h>
 #include <serialization/save_data.h>
 #include <serialization/json_loader.h>
+#include <simulation/cup_simulation.h>
 #include <util/directory_system.h>
+#include <util/random_engine.h>
 
 void NewSave::Init()
 {
@@ -186,6 +188,10 @@ bool NewSave::OnStartupTransitionUpdate(const float deltaTime)
         SaveData::GetInstance().GetUsers().clear();
         SaveData::GetInstance().GetNegotiationCooldowns().clear();
         SaveData::GetInstance().GetTransferHistory().clear();
+        CupSimulation::GetInstance().ClearCups();
+
+        // Every new save gets its own seed which all of its random streams are derived from
+        RandomEngine::GetInstance().SetSeed(RandomEngine::GenerateSeed());
 
         // Load the default data from the player and club database json files
         JSONLoader playersFile("data/players.json");
@@ -2,10 +2,17 @@
 #include <states/continue_game.h>
 
 #include <serialization/save_data.h>
+#include <simulation/cup_simulation.h>
+#include <simulation/league_simulation.h>
+#include <simulation/player_development.h>
+#include <simulation/player_regeneration.h>
+#include <simulation/player_valuation.h>
 #include <util/random_engine.h>
 #include <util/timestamp.h>
 #include <util/globals.h>
 
+#include <algorithm>
+
 void NewSeasonSetup::Init()
 {
     // Initialize member variables
@@ -14,14 +21,41 @@ void NewSeasonSetup::Init()
     // Fetch the Bahnschrift Bold font
     this->font = FontLoader::GetInstance().GetFont("Bahnschrift Bold");
 
+    // Play out the rest of the season in every league and cup, the final tables decide which AI clubs swap leagues with the users' clubs
+    LeagueSimulation::GetInstance().CompleteSeason();
+    CupSimulation::GetInstance().CompleteCups();
+
     // Update database for the start of new season
     this->UpdateCurrentSaveDataState();
 
+    std::unordered_set<uint16_t> releasedPlayers;
     for (UserProfile& user : SaveData::GetInstance().GetUsers())
     {
-        this->UpdateUserClubsState(user);
+        this->UpdateUserClubsState(user, releasedPlayers);
         this->UpdateUserCompetitionStats(user);
     }
+
+    this->PurgeTransferMessages(releasedPlayers);
+
+    // Age and develop every player in the world, then replace the players who retire with youth regens.
+    // This is done after the users' clubs are updated, so the retirement messages aren't cleared from their inboxes.
+    PlayerDevelopment::GetInstance().SimulateSeason();
+    PlayerRegeneration::GetInstance().SimulateSeason();
+
+    // Every player's data has moved on a season, so revalue the whole database
+    PlayerValuation::GetInstance().Recalculate();
+
+    // Club averages have changed over the passes above, so the club indexes have to be rebuilt
+    SaveData::GetInstance().GetClubIndex().Invalidate();
+    SaveData::GetInstance().GetCompetitionRankIndex().Invalidate();
+
+    // The league memberships are settled for the new season, so draw the cups from last season's final tables then clear the tables
+    CupSimulation::GetInstance().DrawCups();
+    LeagueSimulation::GetInstance().StartSeason();
+
+    // Generate the users' objectives last, so they're set from the clubs' squads and strengths for the new season
+    for (UserProfile& user : SaveData::GetInstance().GetUsers())
+        user.GetClub()->GenerateObjectives();
 }
 
 void NewSeasonSetup::Destroy() {}
@@ -101,9 +135,53 @@ void NewSeasonSetup::UpdateCurrentSaveDataState() const
         }
     }
 
-    // Update the league ID linked to the user's clubs
+    // Move the user's clubs into the save's current league. Each club swaps places with an AI club from that league (the lowest placed one 
+    // when moving up, the highest placed one when moving down) so every league keeps the same number of clubs.
+    auto isUserClub = [](const Club* club)
+    {
+        for (UserProfile& user : SaveData::GetInstance().GetUsers())
+        {
+            if (user.GetClub()->GetID() == club->GetID())
+                return true;
+        }
+
+        return false;
+    };
+
+    League* newLeague = SaveData::GetInstance().GetLeague(SaveData::GetInstance().GetCurrentLeague()->GetID());
     for (UserProfile& user : SaveData::GetInstance().GetUsers())
-        user.GetClub()->SetLeague(SaveData::GetInstance().GetCurrentLeague()->GetID());
+    {
+        League* previousLeague = SaveData::GetInstance().GetLeague(user.GetClub()->GetLeague());
+        if (previousLeague == newLeague)
+            continue;
+
+        if (!previousLeague)
+        {
+            newLeague->AddClub(user.GetClub());
+            continue;
+        }
+
+        // Find the AI club which takes the user club's place, using last season's final table of the league being moved into
+        const bool promoted = newLeague->GetTier() < previousLeague->GetTier();
+        const std::vector<LeagueTable::Standing>& standings = newLeague->GetTable().GetStandings();
+
+        Club* replacementClub = nullptr;
+        for (size_t index = 0; index < standings.size() && !replacementClub; index++)
+        {
+            Club* club = SaveData::GetInstance().GetClub(standings[promoted ? standings.size() - index - 1 : index].clubID);
+            if (club && club->GetLeague() == newLeague->GetID() && !isUserClub(club))
+                replacementClub = club;
+        }
+
+        previousLeague->RemoveClub(user.GetClub());
+        newLeague->AddClub(user.GetClub());
+
+        if (replacementClub)
+        {
+            newLeague->RemoveClub(replacementClub);
+            previousLeague->AddClub(replacementClub);
+        }
+    }
 
     // Add new competition stats tracker for the new current league the users are playing in
     for (UserProfile& user : SaveData::GetInstance().GetUsers())
@@ -202,7 +280,7 @@ void NewSeasonSetup::UpdateUserCompetitionStats(UserProfile& user) const
     }
 }
 
-void NewSeasonSetup::UpdateUserClubsState(UserProfile& user) const
+void NewSeasonSetup::UpdateUserClubsState(UserProfile& user, std::unordered_set<uint16_t>& releasedPlayers) const
 {
     // Reset the training staff levels back to 0
     user.GetClub()->GetTrainingStaff(Club::StaffType::GOALKEEPING).level = 0;
@@ -212,9 +290,8 @@ void NewSeasonSetup::UpdateUserClubsState(UserProfile& user) const
 
     // Clear all the general messages in the club's inbox
     user.GetClub()->GetGeneralMessages().clear();
-    
-    // Generate new objectives for the user's club
-    user.GetClub()->GenerateObjectives();
+
+    int releasedGoalkeepers = 0, releasedOutfielders = 0;
 
     auto player = user.GetClub()->GetPlayers().begin();
     while (player != user.GetClub()->GetPlayers().end())
@@ -232,9 +309,12 @@ void NewSeasonSetup::UpdateUserClubsState(UserProfile& user) const
             const int contractLength = RandomEngine::GetInstance().GenerateRandom<int>(2, 5);
             (*player)->SetExpiryYear((*player)->GetExpiryYear() + contractLength);
 
+            const bool goalkeeper = SaveData::GetInstance().GetPositionTraits((*player)->GetPosition()).goalkeeper;
+
             // If the user's club's squad is at the minimum limit then renew every contract which has ended
-            if (((*player)->GetPosition() == 0 && user.GetClub()->GetTotalGoalkeepers() <= Globals::minGoalkeepers) ||
-                ((*player)->GetPosition() > 0 && user.GetClub()->GetTotalOutfielders() <= Globals::minOutfielders))
+            // The released players are only removed from the squad once every player has been checked, so they're discounted here
+            if ((goalkeeper && user.GetClub()->GetTotalGoalkeepers() - releasedGoalkeepers <= Globals::minGoalkeepers) ||
+                (!goalkeeper && user.GetClub()->GetTotalOutfielders() - releasedOutfielders <= Globals::minOutfielders))
             {
                 // Increase the wage of the player and decrease the user club's wage budget
                 const float wageMultiplier = RandomEngine::GetInstance().GenerateRandom<float>(1.25f, 2.0f);
@@ -244,7 +324,7 @@ void NewSeasonSetup::UpdateUserClubsState(UserProfile& user) const
                 user.GetClub()->SetWageBudget(user.GetClub()->GetWageBudget() - ((*player)->GetWage() - playerInitialWages));
                 
                 // Let the user know that this has occurred via general messages.
-                if ((*player)->GetPosition() == 0)
+                if (goalkeeper)
                 {
                     user.GetClub()->GetGeneralMessages().push_back({ "We've had to renew " + std::string((*player)->GetName()) +
                         " on a " + std::to_string(contractLength) + 
@@ -259,84 +339,59 @@ void NewSeasonSetup::UpdateUserClubsState(UserProfile& user) const
             }
             else // Release the player to a random club
             {
-                bool suitableAIClubFound = false;
+                // To keep it realistic, make sure the club chosen isn't way too good/bad for the player
+                constexpr int requiredOverallRange = 5;
+                const int minAverageOverall = ((*player)->GetOverall() >= 60) ? (*player)->GetOverall() - requiredOverallRange : -1;
+                const int maxAverageOverall = ((*player)->GetOverall() >= 60) ? (*player)->GetOverall() + requiredOverallRange : 65;
 
-                while (!suitableAIClubFound)
-                {
-                    // Choose random club from the save's database
-                    const int randomClubIndex = RandomEngine::GetInstance().GenerateRandom<int>(0, (int)SaveData::GetInstance().GetClubDatabase().size() - 1);
-                    Club* aiClub = &SaveData::GetInstance().GetClubDatabase()[randomClubIndex];
+                // If no AI club in the player's range has space for him, let him sign for any AI club which does
+                Club* aiClub = SaveData::GetInstance().GetClubIndex().GetRandomClub(minAverageOverall, maxAverageOverall);
+                if (!aiClub)
+                    aiClub = SaveData::GetInstance().GetClubIndex().GetRandomClub(-1, 99);
 
-                    // Make sure the chosen club isn't controlled by a user
-                    bool clubControlledByUser = false;
-                    for (UserProfile& user : SaveData::GetInstance().GetUsers())
-                    {
-                        if (aiClub->GetID() == user.GetClub()->GetID())
-                        {
-                            clubControlledByUser = true;
-                            break;
-                        }
-                    }
+                if (aiClub)
+                {
+                    // Update the user's club wage budget
+                    user.GetClub()->SetWageBudget(user.GetClub()->GetWageBudget() + (*player)->GetWage());
 
-                    // To keep it realistic, make sure the club chosen isn't way too good/bad for the player
-                    constexpr int requiredOverallRange = 5;
-                    if (!clubControlledByUser)
-                    {
-                        if ((*player)->GetOverall() >= 60)
-                        {
-                            if (aiClub->GetAverageOverall() >= (*player)->GetOverall() - requiredOverallRange &&
-                                aiClub->GetAverageOverall() <= (*player)->GetOverall() + requiredOverallRange)
-                            {
-                                suitableAIClubFound = true;
-                            }
-                        }
-                        else
-                        {
-                            if (aiClub->GetAverageOverall() <= 65)
-                                suitableAIClubFound = true;
-                        }
-                    }
+                    // Send general message to user to let him know that the player has left the club
+                    user.GetClub()->GetGeneralMessages().push_back({ std::string((*player)->GetName().data()) + " has signed for " +
+                        aiClub->GetName().data() + " on a " + std::to_string(contractLength) + " year deal as a free agent." });
 
-                    // The AI club chosen must have enough space in their squad for the player
-                    if (aiClub->GetPlayers().size() >= Globals::maxSquadSize)
-                        suitableAIClubFound = false;
+                    // Move the player to the AI club, he is removed from the user's club along with the rest of the released players below
+                    aiClub->AddPlayer((*player));
+                    releasedPlayers.insert((*player)->GetID());
 
-                    if (suitableAIClubFound)
-                    {
-                        // Update the user's club wage budget
-                        user.GetClub()->SetWageBudget(user.GetClub()->GetWageBudget() + (*player)->GetWage());
-
-                        // Send general message to user to let him know that the player has left the club
-                        user.GetClub()->GetGeneralMessages().push_back({ std::string((*player)->GetName().data()) + " has signed for " +
-                            aiClub->GetName().data() + " on a " + std::to_string(contractLength) + " year deal as a free agent." });
-
-                        // Remove any pending transfer messages involving this player
-                        for (Club& club : SaveData::GetInstance().GetClubDatabase())
-                        {
-                            std::vector<Club::Transfer>& transferInbox = club.GetTransferMessages();
-
-                            for (int index = 0; index < (int)transferInbox.size(); index++)
-                            {
-                                if (transferInbox[index].playerID == (*player)->GetID())
-                                {
-                                    transferInbox.erase(transferInbox.begin() + index);
-                                    --index;
-                                }
-                            }
-                        }
-
-                        // Move the player from the user's club to the AI club
-                        aiClub->AddPlayer((*player));
-                        user.GetClub()->RemovePlayer((*player));
-                    }
+                    if (goalkeeper)
+                        ++releasedGoalkeepers;
+                    else
+                        ++releasedOutfielders;
                 }
-
-                continue; // Skip increment of player iterator pointer
             }
         }
 
         player++;
     }
+
+    // Remove all the released players from the user's club in a single pass
+    std::vector<Player*>& squad = user.GetClub()->GetPlayers();
+    squad.erase(std::remove_if(squad.begin(), squad.end(), 
+        [&releasedPlayers](Player* player) { return releasedPlayers.count(player->GetID()) > 0; }), squad.end());
+}
+
+void NewSeasonSetup::PurgeTransferMessages(const std::unordered_set<uint16_t>& releasedPlayers) const
+{
+    if (releasedPlayers.empty())
+        return;
+
+    // Remove any pending transfer messages involving the released players, every inbox is only visited once regardless of the number of 
+    // players released
+    for (Club& club : SaveData::GetInstance().GetClubDatabase())
+    {
+        std::vector<Club::Transfer>& transferInbox = club.GetTransferMessages();
+        transferInbox.erase(std::remove_if(transferInbox.begin(), transferInbox.end(),
+            [&releasedPlayers](const Club::Transfer& transfer) { return releasedPlayers.count(transfer.playerID) > 0; }), transferInbox.end());
+    }
 }
 
 void NewSeasonSetup::Update(const float& deltaTime) 
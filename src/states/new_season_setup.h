@@ -4,6 +4,7 @@
 #include <core/application_state.h>
 #include <interface/user_interface.h>
 #include <serialization/user_profile.h>
+#include <unordered_set>
 
 class NewSeasonSetup : public AppState
 {
@@ -18,8 +19,13 @@ private:
 	void UpdateUserCompetitionStats(UserProfile& user) const;
 
 	// Updates the given user's club state.
-	// This includes clearing the club's general messages, resetting training staff levels etc.
-	void UpdateUserClubsState(UserProfile& user) const;
+	// This includes clearing the club's general messages, resetting training staff levels etc. The objectives are generated separately,
+	// once every player has been developed for the new season.
+	// The IDs of players released from the club are inserted into the set given.
+	void UpdateUserClubsState(UserProfile& user, std::unordered_set<uint16_t>& releasedPlayers) const;
+
+	// Removes every pending transfer message involving the released players from all the clubs' transfer inboxes.
+	void PurgeTransferMessages(const std::unordered_set<uint16_t>& releasedPlayers) const;
 protected:
 	void Init() override;
 	void Destroy() override;
@@ -3,8 +3,8 @@
 
 #include <interface/menu_button.h>
 #include <serialization/save_data.h>
+#include <simulation/player_valuation.h>
 #include <util/random_engine.h>
-#include <util/data_manip.h>
 
 void PlayerGrowthGeneration::Init()
 {
@@ -31,14 +31,13 @@ void PlayerGrowthGeneration::Init()
             if (player->GetOverall() < player->GetPotential())
             {
                 // Fetch the level of the training staff allocated to the player's position
-                const int staffLevel = user.GetClub()->GetTrainingStaff((Club::StaffType)SaveData::GetInstance().GetPosition(player->GetPosition())->category).level;
+                const SaveData::PositionTraits& positionTraits = SaveData::GetInstance().GetPositionTraits(player->GetPosition());
+                const int staffLevel = user.GetClub()->GetTrainingStaff(positionTraits.staffType).level;
                 
                 // Player growth is calculated differently based on whether the player is an attacking or defensive minded player
                 int overallIncreaseAmount = 0;
 
-                if (SaveData::GetInstance().GetPosition(player->GetPosition())->category == SaveData::PositionCategory::FORWARD ||
-                   (SaveData::GetInstance().GetPosition(player->GetPosition())->category == SaveData::PositionCategory::MIDFIELDER && 
-                       SaveData::GetInstance().GetPosition(player->GetPosition())->type.find("DM") == std::string::npos))
+                if (positionTraits.attackingMinded)
                 {
                     // THIS IS FOR ATTACKING MINDED PLAYERS e.g. ST, LW, CAM, CM etc
                     const float min = (500.0f + totalGoalsScored) * 1.5f;
@@ -79,20 +78,22 @@ void PlayerGrowthGeneration::Init()
 
                 if (overallIncreaseAmount > 0)
                 {
-                    // Increase their value based on amount of growth
-                    const int valueIncrease = RandomEngine::GetInstance().GenerateRandom<int>(250000, 1000000) * 
-                        std::max((int)(overallIncreaseAmount + ((float)((player->GetPotential() - std::max(player->GetOverall(), 70)) / 10.0f))), 1);
-
-                    player->SetValue(Util::GetTruncatedSFInteger(player->GetValue() + valueIncrease, 4));
-
-                    // Add the generated overall increase amount onto the player's current overall
+                    // Add the generated overall increase amount onto the player's current overall, then revalue the player
                     player->SetOverall(player->GetOverall() + overallIncreaseAmount);
+                    PlayerValuation::GetInstance().Revalue(*player);
+
                     this->improvedPlayers[player->GetID()] = overallIncreaseAmount;
                 }
             }
         }
+
+        // The club's average overall may have changed, so update its standing in the competition rankings
+        SaveData::GetInstance().GetCompetitionRankIndex().Refresh(*user.GetClub());
     }
 
+    // Players' overalls have changed, so the clubs have to be bucketed again before the AI picks bidders from the club index
+    SaveData::GetInstance().GetClubIndex().Invalidate();
+
     // Initialize the user interface
     this->userInterface = UserInterface(this->GetAppWindow(), 8.0f, 0.0f);
     this->userInterface.AddButton(new MenuButton({ 1745, 1005 }, { 300, 100 }, { 315, 115 }, "NEXT"));
@@ -4,6 +4,11 @@
 
 #include <interface/menu_button.h>
 #include <serialization/save_data.h>
+#include <simulation/player_valuation.h>
+#include <simulation/transfer_market.h>
+#include <simulation/transfer_price_oracle.h>
+#include <simulation/league_simulation.h>
+#include <simulation/cup_simulation.h>
 #include <util/random_engine.h>
 #include <util/data_manip.h>
 #include <util/globals.h>
@@ -221,8 +226,9 @@ void RecordCompetition::GenerateAIOutboundTransfers()
         for (Player* player : user.GetClub()->GetPlayers())
         {
             // Ensure the user has enough players in their squad in order to be able to sell
-            if ((player->GetPosition() == 0 && user.GetClub()->GetTotalGoalkeepers() > Globals::minGoalkeepers) ||
-                (player->GetPosition() > 0 && user.GetClub()->GetTotalOutfielders() > Globals::minOutfielders))
+            const SaveData::PositionTraits& positionTraits = SaveData::GetInstance().GetPositionTraits(player->GetPosition());
+            if ((positionTraits.goalkeeper && user.GetClub()->GetTotalGoalkeepers() > Globals::minGoalkeepers) ||
+                (!positionTraits.goalkeeper && user.GetClub()->GetTotalOutfielders() > Globals::minOutfielders))
             {
                 // Simple algorithm for AI deciding whether to send an offer for the player
                 int generatedWeight = RandomEngine::GetInstance().GenerateRandom<int>(0, 100);
@@ -234,18 +240,11 @@ void RecordCompetition::GenerateAIOutboundTransfers()
 
                 if (generatedWeight >= 1150)
                 {
-                    // Simple algorithm to decide the amount willing to be bidded for the player
-                    const int min = (int)(std::floor((float)(player->GetValue()) / 2.0f));
-                    const int max = (int)(std::ceil((float)(player->GetValue()) *
-                        std::clamp((float)(player->GetExpiryYear() - SaveData::GetInstance().GetCurrentYear()) / 2.0f, 1.0f, 1.5f)));
-
-                    int openingBid = Util::GetTruncatedSFInteger(RandomEngine::GetInstance().GenerateRandom<int>(min, max), 4);
-
-                    // Select a random AI controlled club to make the bid
-                    Club* biddingAIClub = nullptr;
-                    bool suitableClubFound = false, activeNegotiationCooldownFound = false;
+                    // Decide the amount willing to be bidded for the player
+                    int openingBid = TransferPriceOracle::GetInstance().DrawBuyerMaximum(*player);
 
                     // Don't bother bidding for the player if there is an active negotiation cooldown attached to him
+                    bool activeNegotiationCooldownFound = false;
                     for (SaveData::NegotiationCooldown& cooldown : SaveData::GetInstance().GetNegotiationCooldowns())
                     {
                         if (cooldown.playerID == player->GetID() && cooldown.clubID == 0)
@@ -255,58 +254,28 @@ void RecordCompetition::GenerateAIOutboundTransfers()
                         }
                     }
 
-                    while (!suitableClubFound && !activeNegotiationCooldownFound)
+                    if (!activeNegotiationCooldownFound)
                     {
-                        // Choose random club from the save's database
-                        const int randomClubIndex = RandomEngine::GetInstance().GenerateRandom<int>(0, (int)SaveData::GetInstance().GetClubDatabase().size() - 1);
-                        biddingAIClub = &SaveData::GetInstance().GetClubDatabase()[randomClubIndex];
-
-                        // Make sure the chosen club isn't controlled by a user
-                        bool clubControlledByUser = false;
-                        for (UserProfile& user : SaveData::GetInstance().GetUsers())
-                        {
-                            if (biddingAIClub->GetID() == user.GetClub()->GetID())
-                            {
-                                clubControlledByUser = true;
-                                break;
-                            }
-                        }
-
-                        // Make sure the club hasn't already approached for the player
-                        bool alreadyCurrentlyApproachingPlayer = false;
-                        for (const auto& transferMsg : biddingAIClub->GetTransferMessages())
-                        {
-                            if (transferMsg.playerID == player->GetID())
-                            {
-                                alreadyCurrentlyApproachingPlayer = true;
-                                break;
-                            }
-                        }
-
                         // To keep it realistic, make sure the club chosen isn't way too good/bad for the player
                         constexpr int requiredOverallRange = 5;
-                        if (!clubControlledByUser && !alreadyCurrentlyApproachingPlayer)
-                        {
-                            if (player->GetOverall() >= 60)
+                        const int minAverageOverall = (player->GetOverall() >= 60) ? player->GetOverall() - requiredOverallRange : -1;
+                        const int maxAverageOverall = (player->GetOverall() >= 60) ? player->GetOverall() + requiredOverallRange : 65;
+
+                        // Select a random AI controlled club with squad space to make the bid, making sure the club hasn't already 
+                        // approached for the player
+                        Club* biddingAIClub = SaveData::GetInstance().GetClubIndex().GetRandomClub(minAverageOverall, maxAverageOverall,
+                            [player](const Club& club)
                             {
-                                if (biddingAIClub->GetAverageOverall() >= player->GetOverall() - requiredOverallRange &&
-                                    biddingAIClub->GetAverageOverall() <= player->GetOverall() + requiredOverallRange)
+                                for (const auto& transferMsg : club.GetTransferMessages())
                                 {
-                                    suitableClubFound = true;
+                                    if (transferMsg.playerID == player->GetID())
+                                        return false;
                                 }
-                            }
-                            else
-                            {
-                                if (biddingAIClub->GetAverageOverall() <= 65)
-                                    suitableClubFound = true;
-                            }
-                        }
 
-                        // The bidding AI club chosen must have enough space in their squad for the player being bidded for
-                        if (biddingAIClub->GetPlayers().size() >= Globals::maxSquadSize)
-                            suitableClubFound = false;
+                                return true;
+                            });
 
-                        if (suitableClubFound)
+                        if (biddingAIClub)
                         {
                             // Slash the amount bidded if the player's wage will consume at least half the club's wage budget
                             if (player->GetWage() >= (biddingAIClub->GetWageBudget() / 2.0f))
@@ -384,9 +353,10 @@ void RecordCompetition::HandleAIClubsTransferResponses()
                     Club* sellerClub = SaveData::GetInstance().GetClub(targettedPlayer->GetClub());
 
                     // As an absolute caution, make sure both clubs meet the squad size requirements
+                    const SaveData::PositionTraits& positionTraits = SaveData::GetInstance().GetPositionTraits(targettedPlayer->GetPosition());
                     const bool squadSizeRequirementsMet = (club.GetPlayers().size() < Globals::maxSquadSize) &&
-                        ((targettedPlayer->GetPosition() == 0 && sellerClub->GetTotalGoalkeepers() > Globals::minGoalkeepers) || 
-                        (targettedPlayer->GetPosition() > 0 && sellerClub->GetTotalOutfielders() > Globals::minOutfielders));
+                        ((positionTraits.goalkeeper && sellerClub->GetTotalGoalkeepers() > Globals::minGoalkeepers) || 
+                        (!positionTraits.goalkeeper && sellerClub->GetTotalOutfielders() > Globals::minOutfielders));
 
                     if (transfer.feeAgreed && squadSizeRequirementsMet)
                     {
@@ -397,12 +367,8 @@ void RecordCompetition::HandleAIClubsTransferResponses()
                     }
                     else
                     {
-                        // Simple algorithm to decide the amount willing to be bidded for the player
-                        const int min = (int)(std::floor((float)(targettedPlayer->GetValue()) / 2.0f));
-                        const int max = (int)(std::ceil((float)(targettedPlayer->GetValue()) *
-                            std::clamp((float)(targettedPlayer->GetExpiryYear() - SaveData::GetInstance().GetCurrentYear()) / 2.0f, 1.0f, 1.5f)));
-
-                        const int willingAmountToBid = Util::GetTruncatedSFInteger(RandomEngine::GetInstance().GenerateRandom<int>(min, max), 4);
+                        // Decide the amount willing to be bidded for the player
+                        const int willingAmountToBid = TransferPriceOracle::GetInstance().DrawBuyerMaximum(*targettedPlayer);
 
                         if ((willingAmountToBid >= transfer.transferFee) && squadSizeRequirementsMet)
                         {
@@ -453,14 +419,8 @@ void RecordCompetition::HandleAIClubsTransferResponses()
                 {
                     Club* biddingClub = SaveData::GetInstance().GetClub(transfer.biddingClubID);
 
-                    // Simple algorithm to decide the minimum required amount wanted for player
-                    const int min = (int)(std::floor((float)targettedPlayer->GetValue() / 1.5f));
-                    const int max = (int)(std::ceil((float)targettedPlayer->GetValue() *
-                        (1.5f + (((float)targettedPlayer->GetExpiryYear() - (float)SaveData::GetInstance().GetCurrentYear()) / 10.0f))));
-
-                    int minRequiredBid = Util::GetTruncatedSFInteger(RandomEngine::GetInstance().GenerateRandom<int>(min, max), 4);
-                    if (targettedPlayer->GetReleaseClause() > 0 && minRequiredBid > targettedPlayer->GetReleaseClause())
-                        minRequiredBid = targettedPlayer->GetReleaseClause();
+                    // Decide the minimum required amount wanted for player, this is never more than the player's release clause
+                    const int minRequiredBid = TransferPriceOracle::GetInstance().DrawSellerMinimum(*targettedPlayer);
 
                     if (transfer.transferFee >= minRequiredBid)
                     {
@@ -597,10 +557,20 @@ void RecordCompetition::UpdateTransferMessagesTicks()
 
 void RecordCompetition::UpdateSaveDatabaseState()
 {
+    // Revalue every player first, so the AI's bids and responses are based on up to date values
+    PlayerValuation::GetInstance().Recalculate();
+
     this->UpdateTransferMessagesTicks();
     this->UpdateNegotiationCooldowns();
     this->HandleAIClubsTransferResponses();
     this->GenerateAIOutboundTransfers();
+
+    TransferMarket::GetInstance().SimulateTick();
+
+    // Play the AI clubs' league fixtures and cup ties up to the point the users have reached, the users' recorded results go into the 
+    // same tables and brackets
+    LeagueSimulation::GetInstance().AdvanceSeason();
+    CupSimulation::GetInstance().AdvanceCups();
 }
 
 void RecordCompetition::Update(const float& deltaTime)
@@ -5,6 +5,7 @@
 #include <serialization/save_data.h>
 #include <serialization/json_loader.h>
 #include <util/directory_system.h>
+#include <util/random_engine.h>
 #include <thread>
 
 void SaveLoading::Init()
@@ -75,6 +76,8 @@ void SaveLoading::ExecuteLoadingProcess()
     // Open the leagues JSON file and load every league's data
     JSONLoader leaguesFile("data/leagues.json");
     SaveData::GetInstance().LoadLeaguesFromJSON(leaguesFile.GetRoot());
+    SaveData::GetInstance().LoadLeagueTablesFromJSON(saveFileLoader.GetRoot());
+    SaveData::GetInstance().LoadCupBracketsFromJSON(saveFileLoader.GetRoot());
 
     {
         std::scoped_lock lock(this->mutex);
@@ -85,6 +88,12 @@ void SaveLoading::ExecuteLoadingProcess()
     SaveData::GetInstance().SetCurrentYear(saveFileLoader.GetRoot()["currentYear"].get<uint16_t>());
     SaveData::GetInstance().SetCurrentLeague(SaveData::GetInstance().GetLeague(saveFileLoader.GetRoot()["currentLeagueID"].get<uint16_t>()));
 
+    // Restore the save's random seed (saves made before seeds were stored are given a new one, which is written on the next save)
+    if (saveFileLoader.GetRoot().contains("randomSeed"))
+        RandomEngine::GetInstance().SetSeed(saveFileLoader.GetRoot()["randomSeed"].get<uint64_t>());
+    else
+        RandomEngine::GetInstance().SetSeed(RandomEngine::GenerateSeed());
+
     // We don't want to waste time writting the same loaded data back to the file, so clear the JSON loaders
     saveFileLoader.Clear();
     leaguesFile.Clear();
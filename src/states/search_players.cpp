@@ -4,11 +4,33 @@
 
 #include <interface/menu_button.h>
 #include <serialization/save_data.h>
+#include <simulation/scouting_engine.h>
+
+namespace
+{
+    // The time in seconds the filters have to stay unchanged for before they're searched for
+    constexpr float searchDebounceTime = 0.15f;
+
+    // The categories of the player selection list, in the order they're added
+    enum class PlayerCategory : int
+    {
+        NAME,
+        CLUB,
+        POSITION,
+        AGE,
+        OVERALL,
+        POTENTIAL
+    };
+}
 
 void SearchPlayers::Init()
 {
     // Initialize the member variables
     this->exitState = false;
+    this->searchPending = false;
+    this->debounceTimer = 0.0f;
+    this->requestedSearch = this->displayedSearch = 0;
+    this->publishedSearch = 0;
 
     // Fetch the Bahnschrift Bold font
     this->font = FontLoader::GetInstance().GetFont("Bahnschrift Bold");
@@ -21,82 +43,223 @@ void SearchPlayers::Init()
     this->userInterface.AddTextField("Club", TextInputField({ 1000, 155 }, { 400, 70 }, TextInputField::Restrictions::NONE, 255, 2.5f));
     this->userInterface.AddTextField("Position", TextInputField({ 1670, 155 }, { 400, 70 }, TextInputField::Restrictions::NO_SPACES, 255, 2.5f));
 
-    this->userInterface.AddSelectionList("Players", { { 960, 540 }, { 1860, 640 }, 80, 255, 25 });
+    this->userInterface.AddTextField("Max Age", TextInputField({ 400, 255 }, { 200, 70 }, TextInputField::Restrictions::NO_ALPHABETIC | 
+        TextInputField::Restrictions::NO_SPACES, 255, 2.5f));
+    this->userInterface.AddTextField("Min Potential", TextInputField({ 1000, 255 }, { 200, 70 }, TextInputField::Restrictions::NO_ALPHABETIC | 
+        TextInputField::Restrictions::NO_SPACES, 255, 2.5f));
+    this->userInterface.AddTickBox("Affordable Only", TickBox({ 1200, 255 }, { 40, 40 }, "Only show affordable players", 255, 0));
+
+    this->userInterface.AddTextField("Filters", TextInputField({ 1000, 355 }, { 1640, 70 }, TextInputField::Restrictions::ALLOW_SYMBOLS, 255, 2.5f));
+
+    this->userInterface.AddSelectionList("Players", { { 960, 680 }, { 1860, 480 }, 80, 255, 25 });
+    this->userInterface.GetSelectionList("Players")->SetSortingEnabled(true);
     this->userInterface.GetSelectionList("Players")->AddCategory("Name");
     this->userInterface.GetSelectionList("Players")->AddCategory("Club");
-    this->userInterface.GetSelectionList("Players")->AddCategory("Position");
+    this->userInterface.GetSelectionList("Players")->AddCategory("Position", SelectionList::SortType::KEY);
+    this->userInterface.GetSelectionList("Players")->AddCategory("Age", SelectionList::SortType::KEY);
+    this->userInterface.GetSelectionList("Players")->AddCategory("Overall", SelectionList::SortType::KEY);
+    this->userInterface.GetSelectionList("Players")->AddCategory("Potential", SelectionList::SortType::KEY);
+
+    // Take a fresh copy of the player data for the scouting engine to search through
+    ScoutingEngine::GetInstance().GatherColumns();
 }
 
-void SearchPlayers::Destroy() {}
+void SearchPlayers::Destroy()
+{
+    this->StopSearching();
+}
 
 void SearchPlayers::Resume()
 {
+    // The viewed player may have been signed or had his contract changed, so the scouting engine's copy of the player data is refreshed
+    this->StopSearching();
+    ScoutingEngine::GetInstance().GatherColumns();
     this->Reset();
 }
 
-void SearchPlayers::UpdateSelectionList()
+void SearchPlayers::FetchPlayerRow(size_t resultIndex, SelectionList::Element& element) const
 {
-    // Tranform the filter inputs into upper case
-    std::string playerNameFilter = this->userInterface.GetTextField("Name")->GetInputtedText();
-    std::string clubNameFilter = this->userInterface.GetTextField("Club")->GetInputtedText();
-    std::string positionFilter = this->userInterface.GetTextField("Position")->GetInputtedText();
+    const uint32_t playerIndex = this->displayedResults.playerIndices[resultIndex];
+    const Player& player = SaveData::GetInstance().GetPlayerDatabase()[playerIndex];
+
+    element.categoryValues = { player.GetName().data(), SaveData::GetInstance().GetClub(player.GetClub())->GetName().data(),
+        SaveData::GetInstance().GetPosition(player.GetPosition())->type, std::to_string(player.GetAge()), std::to_string(player.GetOverall()),
+        std::to_string(player.GetPotential()) };
+
+    element.sortKeys = { 0, 0, player.GetPosition(), player.GetAge(), player.GetOverall(), player.GetPotential() };
+    element.value = (int)playerIndex;
+}
 
-    std::transform(playerNameFilter.begin(), playerNameFilter.end(), playerNameFilter.begin(), ::toupper);
-    std::transform(clubNameFilter.begin(), clubNameFilter.end(), clubNameFilter.begin(), ::toupper);
-    std::transform(positionFilter.begin(), positionFilter.end(), positionFilter.begin(), ::toupper);
+int64_t SearchPlayers::GetPlayerSortKey(size_t resultIndex, int category) const
+{
+    const Player& player = SaveData::GetInstance().GetPlayerDatabase()[this->displayedResults.playerIndices[resultIndex]];
 
-    if (playerNameFilter.empty() && clubNameFilter.empty() && positionFilter.empty() && 
-        !this->userInterface.GetSelectionList("Players")->GetListElements().empty())
+    switch ((PlayerCategory)category)
     {
-        this->userInterface.GetSelectionList("Players")->Clear();
+    case PlayerCategory::POSITION:
+        return player.GetPosition();
+    case PlayerCategory::AGE:
+        return player.GetAge();
+    case PlayerCategory::OVERALL:
+        return player.GetOverall();
+    case PlayerCategory::POTENTIAL:
+        return player.GetPotential();
+    default:
+        return 0;
     }
-    else if (this->previousNameEntry != playerNameFilter || this->previousClubEntry != clubNameFilter || this->previousPositionEntry != positionFilter)
+}
+
+std::string SearchPlayers::GetPlayerSortText(size_t resultIndex, int category) const
+{
+    const Player& player = SaveData::GetInstance().GetPlayerDatabase()[this->displayedResults.playerIndices[resultIndex]];
+
+    switch ((PlayerCategory)category)
     {
-        // Update the selection list with players matching the filter settings specified
-        this->userInterface.GetSelectionList("Players")->Clear();
+    case PlayerCategory::NAME:
+        return std::string(player.GetName());
+    case PlayerCategory::CLUB:
+        return std::string(SaveData::GetInstance().GetClub(player.GetClub())->GetName());
+    default:
+        return std::string();
+    }
+}
+
+PlayerSearch::Query SearchPlayers::GetEnteredQuery()
+{
+    const Club* userClub = MainGame::GetAppState()->GetCurrentUser()->GetClub();
+
+    // Tranform the filter inputs into the form the names are compared in
+    PlayerSearch::Query query;
+    query.playerName = NameIndex::FoldName(this->userInterface.GetTextField("Name")->GetInputtedText());
+    query.clubName = NameIndex::FoldName(this->userInterface.GetTextField("Club")->GetInputtedText());
+    query.position = this->userInterface.GetTextField("Position")->GetInputtedText();
+    query.maxAge = this->userInterface.GetTextField("Max Age")->GetInputtedText();
+    query.minPotential = this->userInterface.GetTextField("Min Potential")->GetInputtedText();
+    query.filters = this->userInterface.GetTextField("Filters")->GetInputtedText();
+    query.affordableOnly = this->userInterface.GetTickBox("Affordable Only")->isCurrentlyTicked();
+
+    std::transform(query.position.begin(), query.position.end(), query.position.begin(), ::toupper);
 
-        for (size_t playerIndex = 0; playerIndex < SaveData::GetInstance().GetPlayerDatabase().size(); playerIndex++)
+    query.clubID = userClub->GetID();
+    query.transferBudget = userClub->GetTransferBudget();
+    query.wageBudget = userClub->GetWageBudget();
+
+    return query;
+}
+
+void SearchPlayers::DispatchSearch()
+{
+    const uint64_t searchID = ++this->requestedSearch;
+    const PlayerSearch::Query query = this->latestQuery, previousQuery = this->displayedQuery;
+
+    // Only hand over the displayed results if the search can refine them, otherwise there's no point copying them
+    PlayerSearch::Results results;
+    if (PlayerSearch::Refines(query, previousQuery, this->displayedResults))
+        results = this->displayedResults;
+
+    this->searchWorker.Dispatch([this, searchID, query, previousQuery, results](const BackgroundWorker::CancellationToken& cancelled) mutable
         {
-            // Retrieve the player, club and position from the save database
-            const Player& player = SaveData::GetInstance().GetPlayerDatabase()[playerIndex];
-            const Club& club = *SaveData::GetInstance().GetClub(player.GetClub());
-            const SaveData::Position& position = *SaveData::GetInstance().GetPosition(player.GetPosition());
-
-            // Transform the player name and club name into upper case
-            std::string playerName = player.GetName().data();
-            std::string clubName = club.GetName().data();
-
-            std::transform(playerName.begin(), playerName.end(), playerName.begin(), ::toupper);
-            std::transform(clubName.begin(), clubName.end(), clubName.begin(), ::toupper);
-
-            // Add the players which match the filters specified into the selection list and aren't already in the current user's club
-            if ((playerNameFilter.empty() || playerName.find(playerNameFilter) != std::string_view::npos) &&
-                (clubNameFilter.empty() || clubName.find(clubNameFilter) != std::string_view::npos) &&
-                (positionFilter.empty() || position.type.find(positionFilter) != std::string::npos) && 
-                club.GetID() != MainGame::GetAppState()->GetCurrentUser()->GetClub()->GetID())
-            {
-                this->userInterface.GetSelectionList("Players")->AddElement({ player.GetName().data(), club.GetName().data(), position.type }, 
-                    (int)playerIndex);
-            }
+            if (!PlayerSearch::Run(query, previousQuery, results, cancelled))
+                return;
+
+            // Hand the results over to the main thread, which swaps them into the selection list in one go
+            std::lock_guard<std::mutex> lock(this->publishMutex);
+            this->publishedQuery = query;
+            this->publishedResults = std::move(results);
+            this->publishedSearch = searchID;
+        });
+}
+
+void SearchPlayers::StopSearching()
+{
+    this->searchWorker.Cancel();
+    this->searchWorker.Wait();
+}
+
+void SearchPlayers::UpdateSelectionList(const float& deltaTime)
+{
+    const PlayerSearch::Query query = this->GetEnteredQuery();
+    if (query != this->latestQuery)
+    {
+        // The filters have changed, so the search being run is out of date
+        this->latestQuery = query;
+        this->debounceTimer = 0.0f;
+        this->searchWorker.Cancel();
+        ++this->requestedSearch;
+
+        PlayerFilter filter;
+        this->filterError = filter.Parse(query.filters) ? std::string() : filter.GetError();
+
+        if (!this->filterError.empty())
+        {
+            // The structured filters are most likely still being typed, so the current results are kept until they can be parsed
+            this->displayedSearch = this->requestedSearch;
+            this->searchPending = false;
+        }
+        else if (query.IsEmpty())
+        {
+            // There's nothing to search for, so the list is cleared straight away
+            this->displayedQuery = query;
+            this->displayedResults = PlayerSearch::Results();
+            this->displayedSearch = this->requestedSearch;
+            this->searchPending = false;
+
+            this->userInterface.GetSelectionList("Players")->Clear();
+        }
+        else
+        {
+            this->searchPending = true;
+        }
+    }
+
+    // Only search once the user has stopped typing for a moment
+    if (this->searchPending)
+    {
+        this->debounceTimer += deltaTime;
+        if (this->debounceTimer >= searchDebounceTime)
+        {
+            this->searchPending = false;
+            this->DispatchSearch();
         }
+    }
 
-        // This to keep track so we don't need to update if no filters have been modified
-        this->previousNameEntry = playerNameFilter;
-        this->previousClubEntry = clubNameFilter;
-        this->previousPositionEntry = positionFilter;
+    // Swap in the results of the latest search once the background worker has published them
+    if (this->publishedSearch == this->requestedSearch && this->displayedSearch != this->requestedSearch)
+    {
+        {
+            std::lock_guard<std::mutex> lock(this->publishMutex);
+            this->displayedQuery = this->publishedQuery;
+            this->displayedResults = std::move(this->publishedResults);
+        }
+
+        this->displayedSearch = this->requestedSearch;
+
+        // The list only fetches the rows of the page being shown, so a broad search doesn't build a row for every result
+        this->userInterface.GetSelectionList("Players")->SetDataSource(this->displayedResults.playerIndices.size(),
+            [this](size_t index, SelectionList::Element& element) { this->FetchPlayerRow(index, element); },
+            [this](size_t index, int category) { return this->GetPlayerSortKey(index, category); },
+            [this](size_t index, int category) { return this->GetPlayerSortText(index, category); });
     }
 }
 
 void SearchPlayers::Reset()
 {
+    this->StopSearching();
+
     // Clear the filter inputs
     this->userInterface.GetTextField("Name")->Clear();
     this->userInterface.GetTextField("Club")->Clear();
     this->userInterface.GetTextField("Position")->Clear();
+    this->userInterface.GetTextField("Max Age")->Clear();
+    this->userInterface.GetTextField("Min Potential")->Clear();
+    this->userInterface.GetTextField("Filters")->Clear();
+    this->userInterface.GetTickBox("Affordable Only")->Reset();
 
-    this->previousNameEntry.clear();
-    this->previousClubEntry.clear();
-    this->previousPositionEntry.clear();
+    this->latestQuery = this->displayedQuery = PlayerSearch::Query();
+    this->filterError.clear();
+    this->displayedResults = PlayerSearch::Results();
+    this->searchPending = false;
+    this->displayedSearch = ++this->requestedSearch;
 
     // Clear the player selection list
     this->userInterface.GetSelectionList("Players")->Clear();
@@ -123,12 +286,15 @@ void SearchPlayers::Update(const float& deltaTime)
         {
             this->userInterface.GetSelectionList("Players")->Reset();
 
+            // The viewed player may be signed, so the search has to stop reading the save's database first
+            this->StopSearching();
+
             ViewPlayer::GetAppState()->SetPlayerToView(&SaveData::GetInstance().GetPlayerDatabase()[playerSelectionIndex]);
             this->PushState(ViewPlayer::GetAppState());
         }
         
         // Update the selection list options
-        this->UpdateSelectionList();
+        this->UpdateSelectionList(deltaTime);
     }
     else
     {
@@ -141,11 +307,23 @@ void SearchPlayers::Render() const
 {
     // Render the filter background bar
     Renderer::GetInstance().RenderSquare({ 960, 155 }, { 1860, 90 }, { glm::vec3(30), this->userInterface.GetOpacity() });
+    Renderer::GetInstance().RenderSquare({ 960, 255 }, { 1860, 90 }, { glm::vec3(30), this->userInterface.GetOpacity() });
+    Renderer::GetInstance().RenderSquare({ 960, 355 }, { 1860, 90 }, { glm::vec3(30), this->userInterface.GetOpacity() });
 
     // Render the filter label texts
     Renderer::GetInstance().RenderShadowedText({ 50, 170 }, { glm::vec3(255), this->userInterface.GetOpacity() }, this->font, 40, "Name: ", 5);
     Renderer::GetInstance().RenderShadowedText({ 675, 170 }, { glm::vec3(255), this->userInterface.GetOpacity() }, this->font, 40, "Club: ", 5);
     Renderer::GetInstance().RenderShadowedText({ 1280, 170 }, { glm::vec3(255), this->userInterface.GetOpacity() }, this->font, 40, "Position: ", 5);
+    Renderer::GetInstance().RenderShadowedText({ 50, 270 }, { glm::vec3(255), this->userInterface.GetOpacity() }, this->font, 40, "Max Age: ", 5);
+    Renderer::GetInstance().RenderShadowedText({ 580, 270 }, { glm::vec3(255), this->userInterface.GetOpacity() }, this->font, 40, "Min Potential: ", 5);
+    Renderer::GetInstance().RenderShadowedText({ 50, 370 }, { glm::vec3(255), this->userInterface.GetOpacity() }, this->font, 40, "Filters: ", 5);
+
+    // Render the reason the structured filters couldn't be parsed
+    if (!this->filterError.empty())
+    {
+        Renderer::GetInstance().RenderShadowedText({ 50, 1030 }, { 255, 0, 0, this->userInterface.GetOpacity() }, this->font, 40,
+            "FILTER ERROR: " + this->filterError, 5);
+    }
 
     // Render the user interface
     this->userInterface.Render();
@@ -3,17 +3,53 @@
 
 #include <core/application_state.h>
 #include <interface/user_interface.h>
+#include <serialization/player_entity.h>
+#include <serialization/player_search.h>
+#include <util/background_worker.h>
+
+#include <atomic>
+#include <mutex>
 
 class SearchPlayers : public AppState
 {
 private:
 	UserInterface userInterface;
 	FontPtr font;
-	std::string previousNameEntry, previousClubEntry, previousPositionEntry;
-	bool exitState;
+
+	// Searches are run on a background worker, a search is only dispatched once the filters have stopped changing for a moment and is
+	// cancelled as soon as they change again
+	BackgroundWorker searchWorker;
+	PlayerSearch::Query latestQuery, displayedQuery, publishedQuery;
+	PlayerSearch::Results displayedResults, publishedResults;
+	std::mutex publishMutex;
+
+	uint64_t requestedSearch, displayedSearch;
+	std::atomic<uint64_t> publishedSearch;
+	float debounceTimer;
+	bool searchPending, exitState;
+
+	std::string filterError; // The reason the structured filters entered couldn't be parsed, empty if they could be
 private:
-	// Fills the selection list with players who match the filters specified by the user.
-	void UpdateSelectionList();
+	// Returns the search query made up of the filters currently entered by the user.
+	PlayerSearch::Query GetEnteredQuery();
+
+	// Dispatches a search for the latest query to the background worker, refining the displayed results if the query allows it.
+	void DispatchSearch();
+
+	// Cancels the search being run, and waits for the background worker to stop reading the save's database.
+	void StopSearching();
+
+	// Starts a new search if the filters have changed, and fills the selection list with the results of the latest search once it's done.
+	void UpdateSelectionList(const float& deltaTime);
+
+	// Fills in the selection list row given with the player at the index of the displayed results given.
+	void FetchPlayerRow(size_t resultIndex, SelectionList::Element& element) const;
+
+	// Returns the value the player at the index of the displayed results given is sorted by in the selection list category given.
+	int64_t GetPlayerSortKey(size_t resultIndex, int category) const;
+
+	// Returns the text the player at the index of the displayed results given is sorted by in the selection list category given.
+	std::string GetPlayerSortText(size_t resultIndex, int category) const;
 protected:
 	void Init() override;
 	void Destroy() override;
@@ -17,10 +17,11 @@ void TransferHistory::Init()
     this->userInterface.AddButton(new MenuButton({ 1745, 1005 }, { 300, 100 }, { 315, 115 }, "BACK"));
 
     this->userInterface.AddSelectionList("Transfer History", { { 960, 490 }, { 1860, 720 }, 80, 255, 25 });
+    this->userInterface.GetSelectionList("Transfer History")->SetSortingEnabled(true);
     this->userInterface.GetSelectionList("Transfer History")->AddCategory("Name");
     this->userInterface.GetSelectionList("Transfer History")->AddCategory("From");
     this->userInterface.GetSelectionList("Transfer History")->AddCategory("To");
-    this->userInterface.GetSelectionList("Transfer History")->AddCategory("Transfer Fee");
+    this->userInterface.GetSelectionList("Transfer History")->AddCategory("Transfer Fee", SelectionList::SortType::KEY);
 
     // Load the transfer history into the list (from newest to oldest hence using the reverse iterator)
     const std::vector<SaveData::PastTransfer>& transferHistory = SaveData::GetInstance().GetTransferHistory();
@@ -34,7 +35,7 @@ void TransferHistory::Init()
         if ((iterator->fromClubID == fromClub->GetID()) || iterator->toClubID == toClub->GetID())
         {
             this->userInterface.GetSelectionList("Transfer History")->AddElement({ player->GetName().data(), fromClub->GetName().data(), 
-                toClub->GetName().data(), Util::GetFormattedCashString(iterator->transferFee) }, -1);
+                toClub->GetName().data(), Util::GetFormattedCashString(iterator->transferFee) }, { 0, 0, 0, iterator->transferFee }, -1);
         }
     }
 }
@@ -3,6 +3,7 @@
 #include <states/main_game.h>
 
 #include <serialization/save_data.h>
+#include <simulation/transfer_price_oracle.h>
 #include <interface/menu_button.h>
 #include <util/random_engine.h>
 #include <util/data_manip.h>
@@ -89,6 +90,22 @@ void TransferNegotiation::Init()
         }
     }
 
+    // Note down which side of the deal the user is on, and whether the club on the other side is controlled by the AI
+    this->userIsBuying = !this->existingTransferNegotiation ||
+        this->existingTransferNegotiation->biddingClubID == MainGame::GetAppState()->GetCurrentUser()->GetClub()->GetID();
+
+    const uint16_t counterpartyClubID = this->userIsBuying ? this->targettedPlayer->GetClub() : this->existingTransferNegotiation->biddingClubID;
+    this->aiCounterparty = true;
+
+    for (const UserProfile& user : SaveData::GetInstance().GetUsers())
+    {
+        if (user.GetClub()->GetID() == counterpartyClubID)
+        {
+            this->aiCounterparty = false;
+            break;
+        }
+    }
+
     // Initialize the user interface
     this->userInterface = UserInterface(this->GetAppWindow(), 8.0f, 0.0f);
     this->userInterface.AddButton(new MenuButton({ 1745, 1005 }, { 300, 100 }, { 315, 115 }, "BACK"));
@@ -161,6 +178,28 @@ bool TransferNegotiation::ValidateInput()
     return !this->actionInvalid && !this->bidAmountInvalid;
 }
 
+void TransferNegotiation::RenderFeeOutlook() const
+{
+    const TransferPriceOracle::Quartiles likelyFee = this->userIsBuying ? TransferPriceOracle::GetInstance().GetSellerMinimum(*this->targettedPlayer) :
+        TransferPriceOracle::GetInstance().GetBuyerMaximum(*this->targettedPlayer);
+
+    Renderer::GetInstance().RenderShadowedText({ 1000, 440 }, { 0, 200, 200, this->userInterface.GetOpacity() }, this->font, 40,
+        "LIKELY FEE: " + Util::GetFormattedCashString(likelyFee.lower) + " - " + Util::GetFormattedCashString(likelyFee.upper), 5);
+
+    // Show how the AI club would respond to the fee entered, as long as it's a fee the user can actually submit
+    const std::string& enteredFee = this->userInterface.GetTextField("Transfer Fee")->GetInputtedText();
+    if (enteredFee.empty() || enteredFee.size() > 9 || this->userInterface.GetTextField("Transfer Fee")->GetOpacity() == 0)
+        return;
+
+    const TransferPriceOracle::Outlook outlook = this->userIsBuying ? 
+        TransferPriceOracle::GetInstance().GetSellerOutlook(*this->targettedPlayer, std::stoi(enteredFee)) :
+        TransferPriceOracle::GetInstance().GetBuyerOutlook(*this->targettedPlayer, std::stoi(enteredFee));
+
+    Renderer::GetInstance().RenderShadowedText({ 1000, 500 }, { glm::vec3(255), this->userInterface.GetOpacity() }, this->font, 35,
+        "ACCEPT: " + std::to_string((int)std::round(outlook.accept * 100.0f)) + "%   COUNTER: " + 
+        std::to_string((int)std::round(outlook.counter * 100.0f)) + "%   REJECT: " + std::to_string((int)std::round(outlook.reject * 100.0f)) + "%", 5);
+}
+
 void TransferNegotiation::Update(const float& deltaTime)
 {
     if (!this->exitState)
@@ -319,6 +358,9 @@ void TransferNegotiation::Render() const
                 "OFFERED TRANSFER FEE: " + Util::GetFormattedCashString(this->existingTransferNegotiation->transferFee), 5);
         }
 
+        if (this->aiCounterparty)
+            this->RenderFeeOutlook();
+
         if (this->existingTransferNegotiation)
         {
             Renderer::GetInstance().RenderShadowedText({ 60, 755 }, { glm::vec3(255), this->userInterface.GetOpacity() }, this->font, 50,
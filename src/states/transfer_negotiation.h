@@ -16,9 +16,14 @@ private:
 	
 	bool exitState, onNegotiationCooldown, alreadyNegotiating, playerNotForSale, submittedResponse;
 	bool actionInvalid, bidAmountInvalid;
+	bool userIsBuying, aiCounterparty;
 private:
 	// Returns TRUE if all the user inputs are valid.
 	bool ValidateInput();
+
+	// Renders the fee range the AI club on the other side of the deal is likely to agree to, along with how it would respond to the fee
+	// entered by the user.
+	void RenderFeeOutlook() const;
 protected:
 	void Init() override;
 	void Destroy() override;
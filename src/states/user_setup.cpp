@@ -108,6 +108,7 @@ void UserSetup::Update(const float& deltaTime)
 
                     // Push the created user profile into the save data
                     SaveData::GetInstance().GetUsers().emplace_back(user);
+                    SaveData::GetInstance().GetClubIndex().Invalidate();
 
                     // Reset the drop downs and text field
                     this->userInterface.GetTextField("Manager Name")->Clear();
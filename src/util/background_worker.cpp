@@ -0,0 +1,90 @@
+#include <util/background_worker.h>
+
+BackgroundWorker::BackgroundWorker() :
+	running(false), stopping(false)
+{}
+
+BackgroundWorker::~BackgroundWorker()
+{
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		this->stopping = true;
+
+		if (this->runningToken)
+			*this->runningToken = true;
+	}
+
+	this->taskCondition.notify_all();
+
+	if (this->thread.joinable())
+		this->thread.join();
+}
+
+void BackgroundWorker::Run()
+{
+	std::unique_lock<std::mutex> lock(this->mutex);
+
+	while (true)
+	{
+		this->taskCondition.wait(lock, [this]() { return this->stopping || this->pendingTask; });
+		if (this->stopping)
+			break;
+
+		// Take the pending task and run it without holding the lock, so new tasks can be dispatched (and cancel it) meanwhile
+		const Task task = std::move(this->pendingTask);
+		this->pendingTask = nullptr;
+		this->runningToken = std::move(this->pendingToken);
+		this->running = true;
+
+		const std::shared_ptr<CancellationToken> token = this->runningToken;
+		lock.unlock();
+
+		task(*token);
+
+		lock.lock();
+		this->runningToken.reset();
+		this->running = false;
+
+		if (!this->pendingTask)
+			this->idleCondition.notify_all();
+	}
+}
+
+void BackgroundWorker::Dispatch(const Task& task)
+{
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+
+		// The worker thread is only started once there's work for it
+		if (!this->thread.joinable())
+			this->thread = std::thread(&BackgroundWorker::Run, this);
+
+		if (this->runningToken)
+			*this->runningToken = true;
+
+		this->pendingTask = task;
+		this->pendingToken = std::make_shared<CancellationToken>(false);
+	}
+
+	this->taskCondition.notify_one();
+}
+
+void BackgroundWorker::Cancel()
+{
+	std::lock_guard<std::mutex> lock(this->mutex);
+
+	if (this->runningToken)
+		*this->runningToken = true;
+
+	this->pendingTask = nullptr;
+	this->pendingToken.reset();
+
+	if (!this->running)
+		this->idleCondition.notify_all();
+}
+
+void BackgroundWorker::Wait()
+{
+	std::unique_lock<std::mutex> lock(this->mutex);
+	this->idleCondition.wait(lock, [this]() { return !this->running && !this->pendingTask; });
+}
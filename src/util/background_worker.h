@@ -0,0 +1,46 @@
+#ifndef BACKGROUND_WORKER_H
+#define BACKGROUND_WORKER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+// Runs tasks one at a time on its own thread. Only the latest task dispatched matters, so dispatching a task cancels the task being run
+// and replaces any task still waiting to be run.
+class BackgroundWorker
+{
+public:
+	// The flag given to a task which is set once the task has been cancelled, long running tasks should check it regularly and return early
+	using CancellationToken = std::atomic<bool>;
+	using Task = std::function<void(const CancellationToken& cancelled)>;
+private:
+	std::thread thread;
+	std::mutex mutex;
+	std::condition_variable taskCondition, idleCondition;
+
+	Task pendingTask;
+	std::shared_ptr<CancellationToken> pendingToken, runningToken;
+	bool running, stopping;
+private:
+	// Waits for tasks and runs them until the worker is stopped.
+	void Run();
+public:
+	BackgroundWorker();
+	BackgroundWorker(const BackgroundWorker& other) = delete;
+	BackgroundWorker(BackgroundWorker&& temp) noexcept = delete;
+	~BackgroundWorker();
+
+	// Queues the task given to be run on the worker's thread, cancelling the task being run and dropping any task waiting to be run.
+	void Dispatch(const Task& task);
+
+	// Cancels the task being run and drops any task waiting to be run, without waiting for the running task to return.
+	void Cancel();
+
+	// Blocks until the worker has no task being run or waiting to be run.
+	void Wait();
+};
+
+#endif
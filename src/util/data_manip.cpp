@@ -14,6 +14,25 @@ int Util::GetTruncatedSFInteger(int num, int sfPrecision)
 	return finalNum;
 }
 
+int Util::CountTruncatedSFAtMost(int min, int max, int threshold, int sfPrecision)
+{
+	if (min > max || Util::GetTruncatedSFInteger(min, sfPrecision) > threshold)
+		return 0;
+
+	// Binary search for the last integer in the range which passes
+	int lower = min, upper = max;
+	while (lower < upper)
+	{
+		const int middle = lower + ((upper - lower + 1) / 2);
+		if (Util::GetTruncatedSFInteger(middle, sfPrecision) <= threshold)
+			lower = middle;
+		else
+			upper = middle - 1;
+	}
+
+	return lower - min + 1;
+}
+
 std::string Util::GetFormattedCashString(int cashAmount)
 {
 	{
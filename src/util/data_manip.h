@@ -8,6 +8,10 @@ namespace Util
 	// Returns integer truncated to the amount of significant figures specified.
 	extern int GetTruncatedSFInteger(int num, int sfPrecision);
 
+	// Returns how many integers in the range [min, max] are at most the threshold given once truncated to the amount of significant
+	// figures specified. Truncating never makes a number bigger, so the integers counted are always the ones at the start of the range.
+	extern int CountTruncatedSFAtMost(int min, int max, int threshold, int sfPrecision);
+
 	// Returns a formatted string representing the integer cash amount specified.
 	extern std::string GetFormattedCashString(int cashAmount);
 }
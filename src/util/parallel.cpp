@@ -0,0 +1,41 @@
+#include <util/parallel.h>
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+void Util::ParallelFor(size_t count, const std::function<void(size_t begin, size_t end)>& task, size_t minChunkSize)
+{
+	if (count == 0)
+		return;
+
+	// Don't bother spinning up threads for ranges which are too small to benefit from them
+	const size_t hardwareThreads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+	const size_t totalChunks = std::min(hardwareThreads, (count + std::max<size_t>(minChunkSize, 1) - 1) / std::max<size_t>(minChunkSize, 1));
+
+	if (totalChunks <= 1)
+	{
+		task(0, count);
+		return;
+	}
+
+	const size_t chunkSize = (count + totalChunks - 1) / totalChunks;
+
+	std::vector<std::thread> workers;
+	workers.reserve(totalChunks - 1);
+
+	for (size_t chunk = 0; chunk < totalChunks - 1; chunk++)
+	{
+		const size_t begin = chunk * chunkSize;
+		const size_t end = std::min(begin + chunkSize, count);
+
+		if (begin < end)
+			workers.emplace_back(task, begin, end);
+	}
+
+	const size_t lastBegin = (totalChunks - 1) * chunkSize;
+	if (lastBegin < count)
+		task(lastBegin, count);
+
+	for (std::thread& worker : workers)
+		worker.join();
+}
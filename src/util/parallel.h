@@ -0,0 +1,13 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <functional>
+
+namespace Util
+{
+	// Splits the range [0, count) into contiguous chunks and runs the task given on each chunk across the available hardware threads.
+	// The calling thread works on the last chunk, and the function only returns once every chunk has been processed.
+	extern void ParallelFor(size_t count, const std::function<void(size_t begin, size_t end)>& task, size_t minChunkSize = 64);
+}
+
+#endif
@@ -1,10 +1,51 @@
 #include <util/random_engine.h>
 #include <chrono>
 
-RandomEngine::RandomEngine()
+RandomEngine::RandomEngine() :
+	seed(RandomEngine::GenerateSeed())
 {
-	auto seed = std::chrono::system_clock::now().time_since_epoch().count();
-	this->randomGenerator = std::mt19937(static_cast<uint32_t>(seed));
+	this->mainStream.Seed(this->seed, 0);
+}
+
+void RandomEngine::SetSeed(uint64_t seed)
+{
+	std::scoped_lock lock(this->mutex);
+	this->seed = seed;
+	this->mainStream.Seed(seed, 0);
+}
+
+void RandomEngine::Fill(int* output, size_t count, int min, int max)
+{
+	std::scoped_lock lock(this->mutex);
+	this->mainStream.Fill(output, count, min, max);
+}
+
+void RandomEngine::Fill(float* output, size_t count, float min, float max)
+{
+	std::scoped_lock lock(this->mutex);
+	this->mainStream.Fill(output, count, min, max);
+}
+
+RandomStream RandomEngine::CreateStream(uint64_t streamID) const
+{
+	return RandomStream(this->seed, streamID + 1);
+}
+
+uint64_t RandomEngine::DeriveSeed()
+{
+	std::scoped_lock lock(this->mutex);
+	return this->mainStream.GenerateSeed();
+}
+
+uint64_t RandomEngine::GetSeed() const
+{
+	return this->seed;
+}
+
+uint64_t RandomEngine::GenerateSeed()
+{
+	uint64_t clockValue = static_cast<uint64_t>(std::chrono::high_resolution_clock::now().time_since_epoch().count());
+	return RandomStream::SplitMix(clockValue);
 }
 
 RandomEngine& RandomEngine::GetInstance()
@@ -1,12 +1,16 @@
 #ifndef RANDOM_ENGINE_H
 #define RANDOM_ENGINE_H
 
-#include <random>
+#include <util/random_stream.h>
+#include <atomic>
+#include <mutex>
 
 class RandomEngine
 {
 private:
-	std::mt19937 randomGenerator;
+	std::atomic<uint64_t> seed; // Atomic so streams can be created from worker threads without taking the main stream's lock
+	RandomStream mainStream; // Seeded with stream ID 0, which is reserved for it
+	std::mutex mutex;
 private:
 	RandomEngine();
 public:
@@ -14,17 +18,34 @@ public:
 	RandomEngine(RandomEngine&& temp) noexcept = delete;
 	~RandomEngine() = default;
 
+	// Sets the seed every stream is derived from and resets the main stream.
+	// This should be called with the save's seed whenever a save is created or loaded.
+	void SetSeed(uint64_t seed);
+
 	// Returns random number between the specified min and max values.
 	template<typename T> T GenerateRandom(T min, T max);
 
-	// Returns random number between the specified min and max values.
-	template<> int GenerateRandom<int>(int min, int max);
+	// Fills the array given with random integers between the specified min and max values (inclusive).
+	void Fill(int* output, size_t count, int min, int max);
 
-	// Returns random number between the specified min and max values.
-	template<> float GenerateRandom<float>(float min, float max);
+	// Fills the array given with random floats between the specified min and max values.
+	void Fill(float* output, size_t count, float min, float max);
 
-	// Returns random number between the specified min and max values.
-	template<> double GenerateRandom<double>(double min, double max);
+	// Returns an independent stream derived from the current seed and the stream ID given.
+	// The stream ID is offset by one, as stream 0 is reserved for the main stream.
+	// The same seed and stream ID will always produce the same stream, so a stream per entity or per worker thread makes
+	// parallel simulation deterministic regardless of how the work is scheduled.
+	RandomStream CreateStream(uint64_t streamID) const;
+
+	// Returns a new seed drawn from the main stream.
+	// Each simulation pass should seed its streams from one of these, so every pass gets different but reproducible numbers.
+	uint64_t DeriveSeed();
+
+	// Returns the seed every stream is currently derived from.
+	uint64_t GetSeed() const;
+
+	// Returns a new seed generated from the system clock.
+	static uint64_t GenerateSeed();
 
 	// Returns singleton instance object of this class.
 	static RandomEngine& GetInstance();
@@ -32,4 +53,4 @@ public:
 
 #include <util/random_engine.tpp>
 
-#endif
\ No newline at end of file
+#endif
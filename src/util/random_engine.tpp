@@ -2,23 +2,6 @@
 
 template<typename T> T RandomEngine::GenerateRandom(T min, T max)
 {
-	static_assert(false);
+	std::scoped_lock lock(this->mutex);
+	return this->mainStream.GenerateRandom<T>(min, max);
 }
-
-template<> int RandomEngine::GenerateRandom(int min, int max)
-{
-	std::uniform_int_distribution<int> random_distributor(min, max);
-	return random_distributor(this->randomGenerator);
-}
-
-template<> float RandomEngine::GenerateRandom(float min, float max)
-{
-	std::uniform_real_distribution<float> random_distributor(min, max);
-	return random_distributor(this->randomGenerator);
-}
-
-template<> double RandomEngine::GenerateRandom(double min, double max)
-{
-	std::uniform_real_distribution<double> random_distributor(min, max);
-	return random_distributor(this->randomGenerator);
-}
\ No newline at end of file
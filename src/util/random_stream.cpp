@@ -0,0 +1,113 @@
+#include <util/random_stream.h>
+
+namespace
+{
+	inline uint64_t RotateLeft(uint64_t value, int shift)
+	{
+		return (value << shift) | (value >> (64 - shift));
+	}
+}
+
+RandomStream::RandomStream() :
+	RandomStream(0)
+{}
+
+RandomStream::RandomStream(uint64_t seed, uint64_t streamID)
+{
+	this->Seed(seed, streamID);
+}
+
+void RandomStream::Seed(uint64_t seed, uint64_t streamID)
+{
+	// Mix the stream ID into the seed before expanding it, so that neighbouring stream IDs (e.g. consecutive club or thread
+	// indices) still end up with completely unrelated generator states
+	uint64_t mixedStreamID = streamID;
+	uint64_t value = seed ^ RandomStream::SplitMix(mixedStreamID);
+
+	for (uint64_t& word : this->state)
+		word = RandomStream::SplitMix(value);
+}
+
+uint64_t RandomStream::Next()
+{
+	// xoshiro256** by David Blackman and Sebastiano Vigna
+	const uint64_t result = RotateLeft(this->state[1] * 5, 7) * 9;
+	const uint64_t temp = this->state[1] << 17;
+
+	this->state[2] ^= this->state[0];
+	this->state[3] ^= this->state[1];
+	this->state[1] ^= this->state[2];
+	this->state[0] ^= this->state[3];
+	this->state[2] ^= temp;
+	this->state[3] = RotateLeft(this->state[3], 45);
+
+	return result;
+}
+
+int RandomStream::GenerateInteger(int min, int max)
+{
+	if (min >= max)
+		return min;
+
+	// Lemire's multiply-shift method, only rejecting the (rare) outputs that would otherwise bias the result
+	const uint32_t range = static_cast<uint32_t>(static_cast<int64_t>(max) - min) + 1;
+	if (range == 0)
+		return static_cast<int>(static_cast<uint32_t>(this->Next() >> 32));
+
+	uint64_t product = (this->Next() >> 32) * range;
+	uint32_t low = static_cast<uint32_t>(product);
+
+	if (low < range)
+	{
+		const uint32_t threshold = (0u - range) % range;
+		while (low < threshold)
+		{
+			product = (this->Next() >> 32) * range;
+			low = static_cast<uint32_t>(product);
+		}
+	}
+
+	return static_cast<int>(static_cast<int64_t>(min) + static_cast<int64_t>(product >> 32));
+}
+
+float RandomStream::GenerateUnitFloat()
+{
+	return static_cast<float>(this->Next() >> 40) * (1.0f / 16777216.0f);
+}
+
+double RandomStream::GenerateUnitDouble()
+{
+	return static_cast<double>(this->Next() >> 11) * (1.0 / 9007199254740992.0);
+}
+
+void RandomStream::Fill(int* output, size_t count, int min, int max)
+{
+	for (size_t index = 0; index < count; index++)
+		output[index] = this->GenerateInteger(min, max);
+}
+
+void RandomStream::Fill(float* output, size_t count, float min, float max)
+{
+	const float range = max - min;
+	for (size_t index = 0; index < count; index++)
+		output[index] = min + (this->GenerateUnitFloat() * range);
+}
+
+uint64_t RandomStream::GenerateSeed()
+{
+	return this->Next();
+}
+
+RandomStream RandomStream::Split()
+{
+	const uint64_t childSeed = this->Next();
+	return RandomStream(childSeed, this->Next());
+}
+
+uint64_t RandomStream::SplitMix(uint64_t& value)
+{
+	uint64_t result = (value += 0x9E3779B97F4A7C15ull);
+	result = (result ^ (result >> 30)) * 0xBF58476D1CE4E5B9ull;
+	result = (result ^ (result >> 27)) * 0x94D049BB133111EBull;
+	return result ^ (result >> 31);
+}
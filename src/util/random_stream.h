@@ -0,0 +1,52 @@
+#ifndef RANDOM_STREAM_H
+#define RANDOM_STREAM_H
+
+#include <cstdint>
+#include <cstddef>
+
+class RandomStream
+{
+private:
+	uint64_t state[4];
+private:
+	// Returns the next raw 64-bit output of the generator and advances its state.
+	uint64_t Next();
+
+	// Returns random integer between the specified min and max values (inclusive).
+	int GenerateInteger(int min, int max);
+
+	// Returns random float in the range [0, 1).
+	float GenerateUnitFloat();
+
+	// Returns random double in the range [0, 1).
+	double GenerateUnitDouble();
+public:
+	RandomStream();
+	RandomStream(uint64_t seed, uint64_t streamID = 0);
+	~RandomStream() = default;
+
+	// Re-seeds the stream, the same seed and stream ID pair will always reproduce the same sequence of numbers.
+	void Seed(uint64_t seed, uint64_t streamID = 0);
+
+	// Returns random number between the specified min and max values.
+	template<typename T> T GenerateRandom(T min, T max);
+
+	// Fills the array given with random integers between the specified min and max values (inclusive).
+	void Fill(int* output, size_t count, int min, int max);
+
+	// Fills the array given with random floats between the specified min and max values.
+	void Fill(float* output, size_t count, float min, float max);
+
+	// Returns a raw 64-bit value from the stream, suitable for seeding other streams.
+	uint64_t GenerateSeed();
+
+	// Returns a new independent stream derived from this one, advancing this stream's state.
+	RandomStream Split();
+
+	// Returns the SplitMix64 scramble of the value given, used to expand seeds into generator state.
+	static uint64_t SplitMix(uint64_t& value);
+};
+
+#include <util/random_stream.tpp>
+
+#endif
@@ -0,0 +1,15 @@
+#include <util/random_stream.h>
+#include <type_traits>
+
+template<typename T> T RandomStream::GenerateRandom(T min, T max)
+{
+	static_assert(std::is_same_v<T, int> || std::is_same_v<T, float> || std::is_same_v<T, double>,
+		"RandomStream::GenerateRandom only supports int, float and double");
+
+	if constexpr (std::is_same_v<T, int>)
+		return this->GenerateInteger(min, max);
+	else if constexpr (std::is_same_v<T, float>)
+		return min + (this->GenerateUnitFloat() * (max - min));
+	else
+		return min + (this->GenerateUnitDouble() * (max - min));
+}